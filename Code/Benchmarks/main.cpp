@@ -0,0 +1,455 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include "GameState.hpp"
+#include "Scene.hpp"
+#include "TlsfAllocator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+
+using namespace x;
+using namespace DirectX;
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr array<u64, 3> kEntityScales {1'000, 10'000, 100'000};
+    constexpr array<u64, 3> kFileScales {64ull << 10, 1ull << 20, 16ull << 20};
+    constexpr u64 kHierarchyBranching = 4;
+    constexpr u32 kMaxSamples         = 10'000;
+    constexpr u32 kSeed               = 0x5eed;
+
+    struct Options {
+        str filter;  // Substring of "Name/scale"; empty runs everything
+        str output;  // JSON file; stdout when empty
+        str label;   // Free-form, e.g. a commit hash, copied into the results
+        u32 minSamples = 5;
+        f64 minSeconds = 0.25;  // Of timed work per case
+    };
+
+    struct Result {
+        str name;
+        u64 scale = 0;
+        u64 items = 0;  // Units of work in one sample: entities, bytes, operations
+        vector<u64> samples;
+        vector<std::pair<str, f64>> counters;
+
+        u64 Median() const {
+            vector<u64> sorted = samples;
+            std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+            return sorted[sorted.size() / 2];
+        }
+    };
+
+    // Results the optimizer can't prove unused
+    volatile u64 gSink = 0;
+
+    class Runner {
+    public:
+        explicit Runner(const Options& options) : _options(options) {}
+
+        // Times `body` over repeated samples, calling `setup` untimed before each one, after
+        // one untimed warm-up. Returns false when the filter skips the case.
+        template<typename Setup, typename Body>
+        bool Measure(const char* name, u64 scale, u64 items, Setup&& setup, Body&& body) {
+            const str id = str(name) + "/" + std::to_string(scale);
+            if (!_options.filter.empty() && id.find(_options.filter) == str::npos) {
+                return false;
+            }
+
+            Result result;
+            result.name  = name;
+            result.scale = scale;
+            result.items = items;
+
+            setup();
+            body();
+
+            u64 total        = 0;
+            const auto limit = CAST<u64>(_options.minSeconds * 1e9);
+            while (result.samples.size() < _options.minSamples ||
+                   (total < limit && result.samples.size() < kMaxSamples)) {
+                setup();
+                const auto start = Clock::now();
+                body();
+                const auto elapsed = CAST<u64>(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+                    .count());
+                result.samples.push_back(elapsed);
+                total += elapsed;
+            }
+
+            fprintf(stderr,
+                    "%-28s %14.3f ms %12.2f ns/item %8zu samples\n",
+                    id.c_str(),
+                    CAST<f64>(result.Median()) / 1e6,
+                    CAST<f64>(result.Median()) / CAST<f64>(std::max<u64>(items, 1)),
+                    result.samples.size());
+            _results.push_back(std::move(result));
+            return true;
+        }
+
+        // Attaches a figure to the case measured last, e.g. the state a sample left behind.
+        void AddCounter(const char* name, f64 value) {
+            _results.back().counters.emplace_back(name, value);
+        }
+
+        str ToJson() const;
+
+    private:
+        Options _options;
+        vector<Result> _results;
+    };
+
+    void AppendEscaped(str& out, const str& text) {
+        for (const char c : text) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (CAST<u8>(c) >= 0x20) {
+                out += c;
+            }
+        }
+    }
+
+    str Runner::ToJson() const {
+        const char* platform =
+#if defined(_WIN32)
+          "Windows";
+#elif defined(__APPLE__)
+          "macOS";
+#elif defined(__linux__)
+          "Linux";
+#else
+          "Unknown";
+#endif
+        const char* compiler =
+#if defined(__clang__)
+          "clang " __clang_version__;
+#elif defined(__GNUC__)
+          "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+          "msvc";
+#else
+          "unknown";
+#endif
+#ifdef NDEBUG
+        constexpr bool release = true;
+#else
+        constexpr bool release = false;
+#endif
+#ifdef X_ENABLE_PROFILING
+        constexpr bool profiling = true;
+#else
+        constexpr bool profiling = false;
+#endif
+
+        str json = R"({"schema":1,"label":")";
+        AppendEscaped(json, _options.label);
+        json += R"(","platform":")";
+        json += platform;
+        json += R"(","compiler":")";
+        AppendEscaped(json, compiler);
+        json += R"(","build":")";
+        json += release ? "release" : "debug";
+        json += R"(","profiling":)";
+        json += profiling ? "true" : "false";
+        json += R"(,"results":[)";
+
+        char numbers[256];
+        for (size_t index = 0; index < _results.size(); ++index) {
+            const Result& result = _results[index];
+            u64 total            = 0;
+            for (const u64 sample : result.samples) {
+                total += sample;
+            }
+            const auto [min, max] =
+              std::minmax_element(result.samples.begin(), result.samples.end());
+            const u64 median = result.Median();
+            const auto items = CAST<f64>(std::max<u64>(result.items, 1));
+
+            json += index > 0 ? "," : "";
+            json += R"({"name":")" + result.name + "\"";
+            snprintf(numbers,
+                     sizeof(numbers),
+                     R"(,"scale":%llu,"items":%llu,"samples":%zu,"minNs":%llu,"medianNs":%llu,)"
+                     R"("meanNs":%llu,"maxNs":%llu,"nsPerItem":%.3f,"itemsPerSecond":%.1f)",
+                     CAST<unsigned long long>(result.scale),
+                     CAST<unsigned long long>(result.items),
+                     result.samples.size(),
+                     CAST<unsigned long long>(*min),
+                     CAST<unsigned long long>(median),
+                     CAST<unsigned long long>(total / result.samples.size()),
+                     CAST<unsigned long long>(*max),
+                     CAST<f64>(median) / items,
+                     median > 0 ? items * 1e9 / CAST<f64>(median) : 0.0);
+            json += numbers;
+
+            json += R"(,"counters":{)";
+            for (size_t counter = 0; counter < result.counters.size(); ++counter) {
+                snprintf(numbers,
+                         sizeof(numbers),
+                         R"(%s"%s":%.6g)",
+                         counter > 0 ? "," : "",
+                         result.counters[counter].first.c_str(),
+                         result.counters[counter].second);
+                json += numbers;
+            }
+            json += "}}";
+        }
+        json += "]}\n";
+        return json;
+    }
+
+    void PopulateTransforms(GameState& state, u64 count, vector<EntityId>* entities = None) {
+        for (u64 index = 0; index < count; ++index) {
+            const EntityId entity = state.CreateEntity();
+            auto& transform       = state.AddComponent<TransformComponent>(entity);
+            transform.SetPosition({CAST<f32>(index), 0.0f, 0.0f});
+            if (entities) { entities->push_back(entity); }
+        }
+    }
+
+    // Parents are assigned breadth-first, giving a tree kHierarchyBranching wide.
+    EntityId PopulateHierarchy(Scene& scene, u64 count) {
+        vector<EntityId> entities;
+        entities.reserve(count);
+        entities.push_back(scene.CreateEntity());
+        for (u64 index = 1; index < count; ++index) {
+            entities.push_back(scene.CreateEntity(entities[(index - 1) / kHierarchyBranching]));
+        }
+        return entities.front();
+    }
+
+    // Destroys a random half of the entities and creates as many again.
+    void BenchEntityChurn(Runner& runner, u64 scale) {
+        GameState state;
+        vector<EntityId> entities;
+        std::mt19937 random(kSeed);
+        runner.Measure(
+          "EntityChurn",
+          scale,
+          scale,
+          [&]() {
+              state = GameState();
+              entities.clear();
+              PopulateTransforms(state, scale, &entities);
+              std::shuffle(entities.begin(), entities.end(), random);
+          },
+          [&]() {
+              for (u64 index = 0; index < scale / 2; ++index) {
+                  state.DestroyEntity(entities[index]);
+              }
+              PopulateTransforms(state, scale / 2);
+          });
+    }
+
+    void BenchComponentIteration(Runner& runner, u64 scale) {
+        GameState state;
+        PopulateTransforms(state, scale);
+        auto& transforms = state.GetComponents<TransformComponent>();
+        runner.Measure(
+          "ComponentIteration",
+          scale,
+          scale,
+          []() {},
+          [&]() {
+              transforms.ForEach([](EntityId, TransformComponent& transform) {
+                  transform.Translate({0.0f, 1.0f, 0.0f});
+                  transform.Update();
+              });
+              gSink = gSink + CAST<u64>(transforms.GetRawComponents().back().GetPosition().y);
+          });
+    }
+
+    // Moving the root propagates world transforms through every node.
+    void BenchHierarchyUpdate(Runner& runner, u64 scale) {
+        Scene scene("Benchmark", GameState());
+        const EntityId root = PopulateHierarchy(scene, scale);
+        f32 offset          = 0.0f;
+        runner.Measure(
+          "HierarchyUpdate",
+          scale,
+          scale,
+          []() {},
+          [&]() {
+              offset += 1.0f;
+              scene.SetWorldTransform(root, XMMatrixTranslation(offset, 0.0f, 0.0f));
+          });
+    }
+
+    void BenchSceneBuild(Runner& runner, u64 scale) {
+        runner.Measure(
+          "SceneBuildUnload",
+          scale,
+          scale,
+          []() {},
+          [&]() {
+              Scene scene("Benchmark", GameState());
+              PopulateHierarchy(scene, scale);
+              scene.Unload();
+          });
+    }
+
+    // Includes destroying the clone.
+    void BenchClone(Runner& runner, u64 scale) {
+        GameState state;
+        PopulateTransforms(state, scale);
+        runner.Measure("GameStateClone", scale, scale, []() {}, [&]() {
+            const GameState clone = state.Clone();
+            gSink = gSink + clone.GetComponents<TransformComponent>().GetRawComponents().size();
+        });
+    }
+
+    void BenchFileIo(Runner& runner, u64 scale, const std::filesystem::path& directory) {
+        const Filesystem::Path path((directory / ("file-" + std::to_string(scale))).string());
+        vector<u8> data(scale);
+        std::mt19937 random(kSeed);
+        std::generate(data.begin(), data.end(), [&]() { return CAST<u8>(random()); });
+
+        runner.Measure("FileWrite", scale, scale, []() {}, [&]() {
+            if (!Filesystem::FileWriter::WriteAllBytes(path, data)) {
+                fprintf(stderr, "Failed to write %s\n", path.CStr());
+                std::exit(1);
+            }
+        });
+        runner.Measure("FileRead", scale, scale, []() {}, [&]() {
+            gSink = gSink + Filesystem::FileReader::ReadAllBytes(path).size();
+        });
+    }
+
+    // Random churn at roughly half occupancy; the counters describe how fragmented the last
+    // sample left the allocator.
+    void BenchTlsfFragmentation(Runner& runner, u64 scale) {
+        constexpr u32 kMinSize = 16;
+        constexpr u32 kMaxSize = 1024;
+        const auto capacity    = CAST<u32>(scale * kMaxSize);
+        const u64 operations   = scale * 4;
+
+        TlsfAllocator allocator(capacity);
+        vector<TlsfAllocator::Handle> live;
+        std::mt19937 random;
+        std::uniform_int_distribution<u32> sizes(kMinSize, kMaxSize);
+        u64 failed = 0;
+
+        const auto reset = [&]() {
+            allocator.Reset();
+            live.clear();
+            random.seed(kSeed);
+            failed = 0;
+        };
+        const auto churn = [&]() {
+            for (u64 index = 0; index < scale; ++index) {
+                live.push_back(allocator.Allocate(sizes(random)));
+            }
+            for (u64 index = 0; index < operations; ++index) {
+                const size_t victim = random() % live.size();
+                if (live[victim] != TlsfAllocator::kInvalidHandle) {
+                    allocator.Free(live[victim]);
+                }
+                live[victim] = allocator.Allocate(sizes(random));
+                if (live[victim] == TlsfAllocator::kInvalidHandle) { ++failed; }
+            }
+        };
+
+        if (runner.Measure("TlsfChurn", scale, scale + operations, reset, churn)) {
+            const u32 free = allocator.GetCapacity() - allocator.GetUsed();
+            runner.AddCounter("freeBlocks", allocator.GetFreeBlockCount());
+            runner.AddCounter("largestFreeBlock", allocator.GetLargestFreeBlock());
+            runner.AddCounter("fragmentation",
+                              free > 0 ? 1.0 - CAST<f64>(allocator.GetLargestFreeBlock()) / free
+                                       : 0.0);
+            runner.AddCounter("failedAllocations", CAST<f64>(failed));
+        }
+
+        size_t moves = 0;
+        const auto fragment = [&]() {
+            reset();
+            churn();
+        };
+        if (runner.Measure("TlsfDefragment", scale, scale, fragment, [&]() {
+                moves = allocator.Defragment().size();
+            })) {
+            runner.AddCounter("moves", CAST<f64>(moves));
+        }
+    }
+
+    void PrintUsage(const char* program) {
+        fprintf(stderr,
+                "Usage: %s [--filter <text>] [--out <results.json>] [--label <text>]\n"
+                "          [--min-samples <n>] [--min-time <seconds>]\n",
+                program);
+    }
+}  // namespace
+
+// Runs every benchmark at each scale, printing a summary to stderr and the results as JSON
+// to stdout or --out. Compare the JSON of two builds to find regressions.
+int main(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const str arg   = argv[i];
+        const bool more = i + 1 < argc;
+        if (arg == "--filter" && more) {
+            options.filter = argv[++i];
+        } else if (arg == "--out" && more) {
+            options.output = argv[++i];
+        } else if (arg == "--label" && more) {
+            options.label = argv[++i];
+        } else if (arg == "--min-samples" && more) {
+            options.minSamples = CAST<u32>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--min-time" && more) {
+            options.minSeconds = std::atof(argv[++i]);
+        } else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::error_code error;
+    const auto directory = std::filesystem::temp_directory_path(error) / "xbench";
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        fprintf(stderr,
+                "Failed to create %s: %s\n",
+                directory.string().c_str(),
+                error.message().c_str());
+        return 1;
+    }
+
+    Runner runner(options);
+    for (const u64 scale : kEntityScales) {
+        BenchEntityChurn(runner, scale);
+        BenchComponentIteration(runner, scale);
+        BenchHierarchyUpdate(runner, scale);
+        BenchSceneBuild(runner, scale);
+        BenchClone(runner, scale);
+        BenchTlsfFragmentation(runner, scale);
+    }
+    for (const u64 scale : kFileScales) {
+        BenchFileIo(runner, scale, directory);
+    }
+    std::filesystem::remove_all(directory, error);
+
+    const str json = runner.ToJson();
+    if (options.output.empty()) {
+        fwrite(json.data(), 1, json.size(), stdout);
+        return 0;
+    }
+
+    FILE* file = fopen(options.output.c_str(), "wb");
+    if (!file || fwrite(json.data(), 1, json.size(), file) != json.size()) {
+        fprintf(stderr, "Failed to write %s\n", options.output.c_str());
+        if (file) { fclose(file); }
+        return 1;
+    }
+    fclose(file);
+    return 0;
+}
@@ -0,0 +1,258 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "CompressedStream.hpp"
+#include "Lz4.hpp"
+
+#include <algorithm>
+
+namespace x::Filesystem {
+#pragma region CompressedStreamWriter
+    CompressedStreamWriter::CompressedStreamWriter(const Path& path,
+                                                   ThreadPool* pool,
+                                                   u32 blockSize)
+        : _stream(path.Str(), std::ios::binary | std::ios::trunc), _pool(pool),
+          _blockSize(std::max(blockSize, 1u)) {
+        const CompressedStreamHeader header {
+          kCompressedStreamMagic, kCompressedStreamVersion, _blockSize, 0};
+        _stream.write(RCAST<const char*>(&header), sizeof(header));
+        _fileOffset = sizeof(header);
+        _block.reserve(_blockSize);
+    }
+
+    CompressedStreamWriter::~CompressedStreamWriter() {
+        Close();
+    }
+
+    bool CompressedStreamWriter::Write(const vector<u8>& buffer) {
+        return Write(buffer.data(), buffer.size());
+    }
+
+    bool CompressedStreamWriter::Write(const void* data, size_t size) {
+        if (!IsOpen()) return false;
+        const auto* bytes = CAST<const u8*>(data);
+        while (size > 0) {
+            const size_t count = std::min<size_t>(size, _blockSize - _block.size());
+            _block.insert(_block.end(), bytes, bytes + count);
+            bytes += count;
+            size -= count;
+            _position += count;
+            if (_block.size() == _blockSize) { SubmitBlock(); }
+        }
+        return _stream.good();
+    }
+
+    bool CompressedStreamWriter::Close() {
+        if (!_stream.is_open()) return false;
+        if (!_block.empty()) { SubmitBlock(); }
+        while (!_pending.empty()) {
+            WriteNextPending();
+        }
+
+        const CompressedStreamFooter footer {
+          _fileOffset, _position, CAST<u32>(_table.size()), kCompressedStreamMagic};
+        _stream.write(RCAST<const char*>(_table.data()),
+                      CAST<std::streamsize>(_table.size() * sizeof(CompressedBlockEntry)));
+        _stream.write(RCAST<const char*>(&footer), sizeof(footer));
+        _stream.flush();
+        const bool ok = _stream.good();
+        _stream.close();
+        return ok;
+    }
+
+    bool CompressedStreamWriter::IsOpen() const {
+        return _stream.is_open() && _stream.good();
+    }
+
+    u64 CompressedStreamWriter::Position() const {
+        return _position;
+    }
+
+    void CompressedStreamWriter::SubmitBlock() {
+        if (!_pool) {
+            std::promise<EncodedBlock> encoded;
+            encoded.set_value(Encode(_block));
+            _pending.push_back(encoded.get_future());
+        } else {
+            // Bound the number of blocks held in memory; the oldest is usually done by now
+            while (_pending.size() >= 2 * CAST<size_t>(_pool->GetThreadCount())) {
+                WriteNextPending();
+            }
+            _pending.push_back(
+              _pool->Submit([block = std::move(_block)]() { return Encode(block); }));
+        }
+        _block.clear();
+        _block.reserve(_blockSize);
+        if (!_pool) { WriteNextPending(); }
+    }
+
+    bool CompressedStreamWriter::WriteNextPending() {
+        const EncodedBlock encoded = _pending.front().get();
+        _pending.pop_front();
+        _stream.write(RCAST<const char*>(encoded.data.data()),
+                      CAST<std::streamsize>(encoded.data.size()));
+        _table.push_back({_fileOffset,
+                          CAST<u32>(encoded.data.size()),
+                          encoded.stored ? CompressedBlockEntry::kStored : 0u});
+        _fileOffset += encoded.data.size();
+        return _stream.good();
+    }
+
+    CompressedStreamWriter::EncodedBlock CompressedStreamWriter::Encode(const vector<u8>& block) {
+        EncodedBlock encoded {vector<u8>(Lz4::CompressBound(block.size())), false};
+        const size_t size =
+          Lz4::Compress(block.data(), block.size(), encoded.data.data(), encoded.data.size());
+        if (size == 0 || size >= block.size()) {
+            encoded.data   = block;
+            encoded.stored = true;
+        } else {
+            encoded.data.resize(size);
+        }
+        return encoded;
+    }
+#pragma endregion
+
+#pragma region CompressedStreamReader
+    CompressedStreamReader::CompressedStreamReader(const Path& path, ThreadPool* pool)
+        : _file(path, MappedFile::AccessHint::Random), _pool(pool) {
+        const auto bytes = _file.Data();
+        if (bytes.size() < sizeof(CompressedStreamHeader) + sizeof(CompressedStreamFooter)) {
+            return;
+        }
+
+        CompressedStreamHeader header {};
+        CompressedStreamFooter footer {};
+        memcpy(&header, bytes.data(), sizeof(header));
+        memcpy(&footer, bytes.data() + bytes.size() - sizeof(footer), sizeof(footer));
+        const u64 tableSize = u64(footer.blockCount) * sizeof(CompressedBlockEntry);
+        if (header.magic != kCompressedStreamMagic || footer.magic != kCompressedStreamMagic ||
+            header.version != kCompressedStreamVersion || header.blockSize == 0 ||
+            footer.tableOffset + tableSize + sizeof(footer) != bytes.size() ||
+            footer.blockCount !=
+              (footer.uncompressedSize + header.blockSize - 1) / header.blockSize) {
+            return;
+        }
+
+        _table.resize(footer.blockCount);
+        if (tableSize > 0) { memcpy(_table.data(), bytes.data() + footer.tableOffset, tableSize); }
+        for (const auto& entry : _table) {
+            if (entry.offset + entry.compressedSize > footer.tableOffset) {
+                _table.clear();
+                return;
+            }
+        }
+
+        _blockSize = header.blockSize;
+        _size      = footer.uncompressedSize;
+        _open      = true;
+    }
+
+    bool CompressedStreamReader::Read(vector<u8>& data, size_t size) {
+        if (!IsOpen() || size == 0) return false;
+        if (_position + size > _size) { size = CAST<size_t>(_size - _position); }
+        data.resize(size);
+        if (!ReadRange(_position, data.data(), size)) { return false; }
+        _position += size;
+        return true;
+    }
+
+    bool CompressedStreamReader::ReadAll(vector<u8>& data) {
+        if (!IsOpen()) return false;
+        data.resize(CAST<size_t>(_size));
+        if (!ReadRange(0, data.data(), data.size())) { return false; }
+        _position = _size;
+        return true;
+    }
+
+    bool CompressedStreamReader::IsOpen() const {
+        return _open;
+    }
+
+    bool CompressedStreamReader::Seek(u64 offset) {
+        if (!IsOpen() || offset > _size) return false;
+        _position = offset;
+        return true;
+    }
+
+    u64 CompressedStreamReader::Position() const {
+        return _position;
+    }
+
+    u64 CompressedStreamReader::Size() const {
+        return _size;
+    }
+
+    void CompressedStreamReader::Close() {
+        _file.Close();
+        _table.clear();
+        _cache.clear();
+        _cachedBlock = ~0u;
+        _size        = 0;
+        _position    = 0;
+        _open        = false;
+    }
+
+    u32 CompressedStreamReader::GetRawSize(u32 block) const {
+        return CAST<u32>(std::min<u64>(_blockSize, _size - u64(block) * _blockSize));
+    }
+
+    bool CompressedStreamReader::DecodeBlock(u32 block, u8* out) const {
+        const auto& entry = _table[block];
+        const auto source = _file.Slice(entry.offset, entry.compressedSize);
+        const u32 rawSize = GetRawSize(block);
+        if (entry.flags & CompressedBlockEntry::kStored) {
+            if (source.size() != rawSize) { return false; }
+            memcpy(out, source.data(), rawSize);
+            return true;
+        }
+        return Lz4::Decompress(source.data(), source.size(), out, rawSize);
+    }
+
+    bool CompressedStreamReader::ReadRange(u64 offset, u8* out, size_t size) {
+        if (size == 0) { return true; }
+        const u32 first = CAST<u32>(offset / _blockSize);
+        const u32 last  = CAST<u32>((offset + size - 1) / _blockSize);
+
+        // Whole blocks decode in place; the (at most two) partial ones go through the cache
+        vector<std::pair<u32, u8*>> direct;
+        for (u32 block = first; block <= last; ++block) {
+            const u64 blockStart = u64(block) * _blockSize;
+            const u64 begin      = std::max(offset, blockStart);
+            const u64 end        = std::min<u64>(offset + size, blockStart + GetRawSize(block));
+            u8* target           = out + (begin - offset);
+
+            if (begin == blockStart && end == blockStart + GetRawSize(block)) {
+                direct.emplace_back(block, target);
+                continue;
+            }
+            if (_cachedBlock != block) {
+                _cache.resize(GetRawSize(block));
+                _cachedBlock = ~0u;
+                if (!DecodeBlock(block, _cache.data())) { return false; }
+                _cachedBlock = block;
+            }
+            memcpy(target, _cache.data() + (begin - blockStart), CAST<size_t>(end - begin));
+        }
+
+        if (!_pool || direct.size() < 2) {
+            for (const auto& [block, target] : direct) {
+                if (!DecodeBlock(block, target)) { return false; }
+            }
+            return true;
+        }
+
+        vector<std::future<bool>> results;
+        results.reserve(direct.size());
+        for (const auto& [block, target] : direct) {
+            results.push_back(
+              _pool->Submit([this, block, target]() { return DecodeBlock(block, target); }));
+        }
+        bool ok = true;
+        for (auto& result : results) {
+            ok &= result.get();
+        }
+        return ok;
+    }
+#pragma endregion
+}  // namespace x::Filesystem
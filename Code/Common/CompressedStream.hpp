@@ -0,0 +1,129 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include "ThreadPool.hpp"
+#include <deque>
+
+namespace x::Filesystem {
+    // Block-compressed stream (.xcs): a header, independently LZ4-compressed blocks of a fixed
+    // uncompressed size (the last may be short), a seek table with one entry per block, and a
+    // footer locating the table. Blocks that don't shrink are stored raw. Because blocks are
+    // independent they (de)compress in parallel, and a seek only decodes the blocks it reads.
+    constexpr u32 kCompressedStreamMagic   = 0x46534358;  // "XCSF"
+    constexpr u32 kCompressedStreamVersion = 1;
+
+    struct CompressedStreamHeader {
+        u32 magic;
+        u32 version;
+        u32 blockSize;
+        u32 reserved;
+    };
+
+    struct CompressedBlockEntry {
+        static constexpr u32 kStored = 1u << 0;
+
+        u64 offset;
+        u32 compressedSize;
+        u32 flags;
+    };
+
+    struct CompressedStreamFooter {
+        u64 tableOffset;
+        u64 uncompressedSize;
+        u32 blockCount;
+        u32 magic;
+    };
+
+    // With a pool, full blocks are compressed on its workers (a bounded number in flight) and
+    // written in order; without one they compress on the calling thread. Close() writes the
+    // seek table and must succeed for the file to be readable.
+    class CompressedStreamWriter {
+    public:
+        static constexpr u32 kDefaultBlockSize = 256 * 1024;
+
+        explicit CompressedStreamWriter(const Path& path,
+                                        ThreadPool* pool = None,
+                                        u32 blockSize    = kDefaultBlockSize);
+        ~CompressedStreamWriter();
+
+        CompressedStreamWriter(const CompressedStreamWriter&)            = delete;
+        CompressedStreamWriter& operator=(const CompressedStreamWriter&) = delete;
+
+        bool Write(const vector<u8>& buffer);
+        bool Write(const void* data, size_t size);
+        bool Close();
+
+        bool IsOpen() const;
+        // Uncompressed bytes written so far.
+        u64 Position() const;
+
+    private:
+        struct EncodedBlock {
+            vector<u8> data;
+            bool stored;
+        };
+
+        std::ofstream _stream;
+        ThreadPool* _pool;
+        u32 _blockSize;
+        vector<u8> _block;
+        std::deque<std::future<EncodedBlock>> _pending;
+        vector<CompressedBlockEntry> _table;
+        u64 _position   = 0;
+        u64 _fileOffset = 0;
+
+        void SubmitBlock();
+        bool WriteNextPending();
+        static EncodedBlock Encode(const vector<u8>& block);
+    };
+
+    // Reads through a memory map. Reads that span several whole blocks decode them straight
+    // into the destination, in parallel when a pool is given; partially covered blocks go
+    // through a one-block cache so small sequential reads decode each block once.
+    class CompressedStreamReader {
+    public:
+        explicit CompressedStreamReader(const Path& path, ThreadPool* pool = None);
+
+        CompressedStreamReader(const CompressedStreamReader&)            = delete;
+        CompressedStreamReader& operator=(const CompressedStreamReader&) = delete;
+
+        // Reads up to `size` bytes from the current position, clamped to the end.
+        bool Read(vector<u8>& data, size_t size);
+        bool ReadAll(vector<u8>& data);
+
+        bool IsOpen() const;
+        bool Seek(u64 offset);
+        u64 Position() const;
+        u64 Size() const;
+        void Close();
+
+        u32 GetBlockSize() const {
+            return _blockSize;
+        }
+
+        u32 GetBlockCount() const {
+            return CAST<u32>(_table.size());
+        }
+
+    private:
+        MappedFile _file;
+        ThreadPool* _pool;
+        vector<CompressedBlockEntry> _table;
+        u32 _blockSize = 0;
+        u64 _size      = 0;
+        u64 _position  = 0;
+        bool _open     = false;
+
+        u32 _cachedBlock = ~0u;
+        vector<u8> _cache;
+
+        u32 GetRawSize(u32 block) const;
+        bool DecodeBlock(u32 block, u8* out) const;
+        bool ReadRange(u64 offset, u8* out, size_t size);
+    };
+}  // namespace x::Filesystem
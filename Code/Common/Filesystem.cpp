@@ -3,9 +3,16 @@
 //
 
 #include "Filesystem.hpp"
+#include "FrameArena.hpp"
+#include "MemoryTracker.hpp"
+#include "MetadataCache.hpp"
+#include "PackArchive.hpp"
+#include "Profiler.hpp"
 #include "Panic.inl"
 
-#include <sstream>
+#include <iterator>
+#include <string_view>
+#include <utility>
 
 #ifdef _WIN32
     // Windows does not define the S_ISREG and S_ISDIR macros in stat.h, so we do.
@@ -24,12 +31,30 @@
         #define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
     #endif
 #else
+    #include <fcntl.h>
+    #include <sys/mman.h>
     #include <sys/stat.h>
 #endif
 
 namespace x::Filesystem {
 #pragma region FileReader
+    namespace {
+        // Packed entries hold the raw bytes; mirror what a text-mode stream would return.
+        str TextFromBytes(std::span<const u8> bytes) {
+            str text(bytes.begin(), bytes.end());
+#ifdef _WIN32
+            text.erase(std::remove(text.begin(), text.end(), '\r'), text.end());
+#endif
+            return text;
+        }
+    }  // namespace
+
     std::vector<u8> FileReader::ReadAllBytes(const Path& path) {
+        X_PROFILE_FUNCTION();
+        const MemoryScope memoryScope(MemoryTag::FileBuffers);
+        if (const auto packed = FindMounted(path)) {
+            return {packed->data.begin(), packed->data.end()};
+        }
         std::ifstream file(path.Str(), std::ios::binary | std::ios::ate);
         if (!file.is_open()) { return {}; }
         const std::streamsize fileSize = file.tellg();
@@ -41,25 +66,55 @@ namespace x::Filesystem {
     }
 
     str FileReader::ReadAllText(const Path& path) {
-        const std::ifstream file(path.Str());
+        X_PROFILE_FUNCTION();
+        const MemoryScope memoryScope(MemoryTag::FileBuffers);
+        if (const auto packed = FindMounted(path)) { return TextFromBytes(packed->data); }
+        std::ifstream file(path.Str());
         if (!file.is_open()) { return {}; }
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        return buffer.str();
+        // Straight into the result, without a stringstream's buffer and copy; text mode only
+        // ever shrinks the file, so its size is enough to reserve
+        str text;
+        file.seekg(0, std::ios::end);
+        text.reserve(CAST<size_t>(std::max<std::streamoff>(file.tellg(), 0)));
+        file.seekg(0, std::ios::beg);
+        text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return text;
     }
 
     std::vector<str> FileReader::ReadAllLines(const Path& path) {
+        X_PROFILE_FUNCTION();
+        const MemoryScope memoryScope(MemoryTag::FileBuffers);
+        if (const auto packed = FindMounted(path)) {
+            // Split in place rather than through a copy of the entry in a string stream
+            const std::string_view text(RCAST<const char*>(packed->data.data()),
+                                        packed->data.size());
+            std::vector<str> lines;
+            size_t start = 0;
+            while (start < text.size()) {
+                size_t end = text.find('\n', start);
+                if (end == std::string_view::npos) { end = text.size(); }
+                str& line = lines.emplace_back(text.substr(start, end - start));
+                if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+                start = end + 1;
+            }
+            return lines;
+        }
         std::ifstream file(path.Str());
         std::vector<str> lines;
         if (!file.is_open()) { return {}; }
         str line;
         while (std::getline(file, line)) {
+            // Text mode already does this on Windows; elsewhere a CRLF ending leaves its '\r'
+            if (!line.empty() && line.back() == '\r') { line.pop_back(); }
             lines.push_back(line);
         }
         return lines;
     }
 
     std::vector<u8> FileReader::ReadBlock(const Path& path, size_t size, u64 offset) {
+        X_PROFILE_FUNCTION();
+        const MemoryScope memoryScope(MemoryTag::FileBuffers);
+        if (const auto packed = FindMounted(path)) { return packed->ReadBlock(offset, size); }
         std::ifstream file(path.Str(), std::ios::binary | std::ios::ate);
         if (!file) { return {}; }
         const std::streamsize fileSize = file.tellg();
@@ -73,6 +128,11 @@ namespace x::Filesystem {
     }
 
     size_t FileReader::QueryFileSize(const Path& path) {
+        if (const auto packed = FindMounted(path)) { return packed->data.size(); }
+        if (const auto cached = MetadataCache::Global().Lookup(path.Str())) {
+            if (cached->type != EntryType::File) { return 0; }
+            if (cached->size != FileMetadata::kUnknownSize) { return CAST<size_t>(cached->size); }
+        }
         std::ifstream file(path.Str(), std::ios::binary | std::ios::ate);
         if (!file.is_open()) { return 0; }
         const std::streamsize fileSize = file.tellg();
@@ -81,7 +141,19 @@ namespace x::Filesystem {
 #pragma endregion
 
 #pragma region FileWriter
+    namespace {
+        // Drops the path's cached metadata once the writer declared after it has closed.
+        struct InvalidateOnClose {
+            const Path& path;
+
+            ~InvalidateOnClose() {
+                MetadataCache::Global().Invalidate(path.Str());
+            }
+        };
+    }  // namespace
+
     bool FileWriter::WriteAllBytes(const Path& path, const std::vector<u8>& data) {
+        const InvalidateOnClose invalidate {path};
         std::ofstream file(path.Str(),
                            std::ios::binary | std::ios::trunc);  // Overwrite existing file
         if (!file) return false;
@@ -90,6 +162,7 @@ namespace x::Filesystem {
     }
 
     bool FileWriter::WriteAllText(const Path& path, const str& text) {
+        const InvalidateOnClose invalidate {path};
         std::ofstream file(path.Str(), std::ios::out | std::ios::trunc);
         if (!file) return false;
         file << text;
@@ -97,6 +170,7 @@ namespace x::Filesystem {
     }
 
     bool FileWriter::WriteAllLines(const Path& path, const std::vector<str>& lines) {
+        const InvalidateOnClose invalidate {path};
         std::ofstream file(path.Str(), std::ios::out | std::ios::trunc);
         if (!file) return false;
         for (const auto& line : lines) {
@@ -107,6 +181,7 @@ namespace x::Filesystem {
     }
 
     bool FileWriter::WriteBlock(const Path& path, const std::vector<u8>& data, u64 offset) {
+        const InvalidateOnClose invalidate {path};
         std::ofstream file(path.Str(),
                            std::ios::binary | std::ios::in |
                              std::ios::out);  // Open in binary read/write mode
@@ -117,42 +192,280 @@ namespace x::Filesystem {
         return file.good();
     }
 
-    std::future<std::vector<u8>> AsyncFileReader::ReadAllBytes(const Path& path) {
-        return runAsync([path]() { return FileReader::ReadAllBytes(path); });
+    std::future<std::vector<u8>> AsyncFileReader::ReadAllBytes(const Path& path,
+                                                               IoPriority priority,
+                                                               const CancellationToken& token) {
+        return IoQueue::Global().Read(path, 0, 0, priority, token);
     }
 
-    std::future<str> AsyncFileReader::ReadAllText(const Path& path) {
-        return runAsync([path]() { return FileReader::ReadAllText(path); });
+    std::future<str> AsyncFileReader::ReadAllText(const Path& path,
+                                                  IoPriority priority,
+                                                  const CancellationToken& token) {
+        return runAsync([path]() { return FileReader::ReadAllText(path); }, priority, token);
     }
 
-    std::future<std::vector<str>> AsyncFileReader::ReadAllLines(const Path& path) {
-        return runAsync([path]() { return FileReader::ReadAllLines(path); });
+    std::future<std::vector<str>> AsyncFileReader::ReadAllLines(const Path& path,
+                                                                IoPriority priority,
+                                                                const CancellationToken& token) {
+        return runAsync([path]() { return FileReader::ReadAllLines(path); }, priority, token);
     }
 
-    std::future<std::vector<u8>>
-    AsyncFileReader::ReadBlock(const Path& path, size_t size, u64 offset) {
-        return runAsync(
-          [path, size, offset]() { return FileReader::ReadBlock(path, size, offset); });
+    std::future<std::vector<u8>> AsyncFileReader::ReadBlock(const Path& path,
+                                                            size_t size,
+                                                            u64 offset,
+                                                            IoPriority priority,
+                                                            const CancellationToken& token) {
+        // A zero size means "whole file" to IoQueue::Read but "nothing" to ReadBlock
+        if (size == 0) {
+            return runAsync([]() { return std::vector<u8> {}; }, priority, token);
+        }
+        return IoQueue::Global().Read(path, offset, size, priority, token);
     }
 
     std::future<bool> AsyncFileWriter::WriteAllBytes(const Path& path,
-                                                     const std::vector<u8>& data) {
-        return runAsync([path, data]() { return FileWriter::WriteAllBytes(path, data); });
+                                                     const std::vector<u8>& data,
+                                                     IoPriority priority,
+                                                     const CancellationToken& token) {
+        return runAsync([path, data]() { return FileWriter::WriteAllBytes(path, data); },
+                        priority,
+                        token);
     }
 
-    std::future<bool> AsyncFileWriter::WriteAllText(const Path& path, const str& text) {
-        return runAsync([path, text]() { return FileWriter::WriteAllText(path, text); });
+    std::future<bool> AsyncFileWriter::WriteAllText(const Path& path,
+                                                    const str& text,
+                                                    IoPriority priority,
+                                                    const CancellationToken& token) {
+        return runAsync([path, text]() { return FileWriter::WriteAllText(path, text); },
+                        priority,
+                        token);
     }
 
     std::future<bool> AsyncFileWriter::WriteAllLines(const Path& path,
-                                                     const std::vector<str>& lines) {
-        return runAsync([path, lines]() { return FileWriter::WriteAllLines(path, lines); });
+                                                     const std::vector<str>& lines,
+                                                     IoPriority priority,
+                                                     const CancellationToken& token) {
+        return runAsync([path, lines]() { return FileWriter::WriteAllLines(path, lines); },
+                        priority,
+                        token);
+    }
+
+    std::future<bool> AsyncFileWriter::WriteBlock(const Path& path,
+                                                  const std::vector<u8>& data,
+                                                  u64 offset,
+                                                  IoPriority priority,
+                                                  const CancellationToken& token) {
+        return runAsync(
+          [path, data, offset]() { return FileWriter::WriteBlock(path, data, offset); },
+          priority,
+          token);
+    }
+
+    std::future<bool> AsyncFileWriter::WriteAllBytes(const Path& path,
+                                                     std::vector<u8>&& data,
+                                                     IoPriority priority,
+                                                     const CancellationToken& token) {
+        return runAsync(
+          [path, data = std::move(data)]() { return FileWriter::WriteAllBytes(path, data); },
+          priority,
+          token);
     }
 
-    std::future<bool>
-    AsyncFileWriter::WriteBlock(const Path& path, const std::vector<u8>& data, u64 offset) {
+    std::future<bool> AsyncFileWriter::WriteAllText(const Path& path,
+                                                    str&& text,
+                                                    IoPriority priority,
+                                                    const CancellationToken& token) {
         return runAsync(
-          [path, data, offset]() { return FileWriter::WriteBlock(path, data, offset); });
+          [path, text = std::move(text)]() { return FileWriter::WriteAllText(path, text); },
+          priority,
+          token);
+    }
+
+    std::future<bool> AsyncFileWriter::WriteAllLines(const Path& path,
+                                                     std::vector<str>&& lines,
+                                                     IoPriority priority,
+                                                     const CancellationToken& token) {
+        return runAsync(
+          [path, lines = std::move(lines)]() { return FileWriter::WriteAllLines(path, lines); },
+          priority,
+          token);
+    }
+
+    std::future<bool> AsyncFileWriter::WriteBlock(const Path& path,
+                                                  std::vector<u8>&& data,
+                                                  u64 offset,
+                                                  IoPriority priority,
+                                                  const CancellationToken& token) {
+        auto write = [path, data = std::move(data), offset]() {
+            return FileWriter::WriteBlock(path, data, offset);
+        };
+        return runAsync(std::move(write), priority, token);
+    }
+
+    namespace {
+        // Runs `work` on the I/O workers and resumes the awaiting coroutine on `executor`.
+        template<typename T>
+        class WorkAwaitable {
+        public:
+            WorkAwaitable(std::function<T()> work,
+                          Executor& executor,
+                          IoPriority priority,
+                          const CancellationToken& token)
+                : _work(std::move(work)), _executor(executor), _priority(priority), _token(token) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            // Nothing may touch `this` after Schedule(); the coroutine can resume and destroy
+            // the awaitable before the I/O thread returns.
+            void await_suspend(std::coroutine_handle<> handle) {
+                IoQueue::Global().Post(
+                  [this, handle]() {
+                      try {
+                          _result.emplace(_work());
+                      } catch (...) { _error = std::current_exception(); }
+                      _executor.Schedule(handle);
+                  },
+                  [this, handle]() {
+                      _error = std::make_exception_ptr(IoCancelled());
+                      _executor.Schedule(handle);
+                  },
+                  _priority,
+                  _token);
+            }
+
+            T await_resume() {
+                if (_error) { std::rethrow_exception(_error); }
+                return std::move(*_result);
+            }
+
+        private:
+            std::function<T()> _work;
+            Executor& _executor;
+            IoPriority _priority;
+            CancellationToken _token;
+            std::optional<T> _result;
+            std::exception_ptr _error;
+        };
+
+        // IoQueue::Read as an awaitable, so whole-file and block reads go through io_uring.
+        class ReadAwaitable {
+        public:
+            ReadAwaitable(const Path& path,
+                          u64 offset,
+                          size_t size,
+                          Executor& executor,
+                          IoPriority priority,
+                          const CancellationToken& token)
+                : _path(path), _offset(offset), _size(size), _executor(executor),
+                  _priority(priority), _token(token) {}
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                IoQueue::Global().Read(_path,
+                                       _offset,
+                                       _size,
+                                       _priority,
+                                       _token,
+                                       [this, handle](std::vector<u8>&& data, bool cancelled) {
+                                           _data      = std::move(data);
+                                           _cancelled = cancelled;
+                                           _executor.Schedule(handle);
+                                       });
+            }
+
+            std::vector<u8> await_resume() {
+                if (_cancelled) { throw IoCancelled(); }
+                return std::move(_data);
+            }
+
+        private:
+            Path _path;
+            u64 _offset;
+            size_t _size;
+            Executor& _executor;
+            IoPriority _priority;
+            CancellationToken _token;
+            std::vector<u8> _data;
+            bool _cancelled = false;
+        };
+    }  // namespace
+
+    Task<std::vector<u8>> AwaitableFileReader::ReadAllBytes(Path path,
+                                                            Executor& executor,
+                                                            IoPriority priority,
+                                                            CancellationToken token) {
+        co_return co_await ReadAwaitable(path, 0, 0, executor, priority, token);
+    }
+
+    Task<str> AwaitableFileReader::ReadAllText(Path path,
+                                               Executor& executor,
+                                               IoPriority priority,
+                                               CancellationToken token) {
+        co_return co_await WorkAwaitable<str>(
+          [&path]() { return FileReader::ReadAllText(path); }, executor, priority, token);
+    }
+
+    Task<std::vector<str>> AwaitableFileReader::ReadAllLines(Path path,
+                                                             Executor& executor,
+                                                             IoPriority priority,
+                                                             CancellationToken token) {
+        co_return co_await WorkAwaitable<std::vector<str>>(
+          [&path]() { return FileReader::ReadAllLines(path); }, executor, priority, token);
+    }
+
+    Task<std::vector<u8>> AwaitableFileReader::ReadBlock(Path path,
+                                                         size_t size,
+                                                         u64 offset,
+                                                         Executor& executor,
+                                                         IoPriority priority,
+                                                         CancellationToken token) {
+        // A zero size means "whole file" to IoQueue::Read but "nothing" to ReadBlock
+        if (size == 0) { co_return std::vector<u8> {}; }
+        co_return co_await ReadAwaitable(path, offset, size, executor, priority, token);
+    }
+
+    Task<bool> AwaitableFileWriter::WriteAllBytes(Path path,
+                                                  std::vector<u8> data,
+                                                  Executor& executor,
+                                                  IoPriority priority,
+                                                  CancellationToken token) {
+        co_return co_await WorkAwaitable<bool>(
+          [&]() { return FileWriter::WriteAllBytes(path, data); }, executor, priority, token);
+    }
+
+    Task<bool> AwaitableFileWriter::WriteAllText(Path path,
+                                                 str text,
+                                                 Executor& executor,
+                                                 IoPriority priority,
+                                                 CancellationToken token) {
+        co_return co_await WorkAwaitable<bool>(
+          [&]() { return FileWriter::WriteAllText(path, text); }, executor, priority, token);
+    }
+
+    Task<bool> AwaitableFileWriter::WriteAllLines(Path path,
+                                                  std::vector<str> lines,
+                                                  Executor& executor,
+                                                  IoPriority priority,
+                                                  CancellationToken token) {
+        co_return co_await WorkAwaitable<bool>(
+          [&]() { return FileWriter::WriteAllLines(path, lines); }, executor, priority, token);
+    }
+
+    Task<bool> AwaitableFileWriter::WriteBlock(Path path,
+                                               std::vector<u8> data,
+                                               u64 offset,
+                                               Executor& executor,
+                                               IoPriority priority,
+                                               CancellationToken token) {
+        co_return co_await WorkAwaitable<bool>(
+          [&]() { return FileWriter::WriteBlock(path, data, offset); },
+          executor,
+          priority,
+          token);
     }
 #pragma endregion
 
@@ -239,7 +552,9 @@ namespace x::Filesystem {
     }
 
     StreamWriter::StreamWriter(const Path& path, bool append)
-        : _stream(path.Str(), std::ios::binary | (append ? std::ios::app : std::ios::trunc)) {}
+        : _stream(path.Str(), std::ios::binary | (append ? std::ios::app : std::ios::trunc)) {
+        MetadataCache::Global().Invalidate(path.Str());
+    }
 
     StreamWriter::~StreamWriter() {
         Close();
@@ -301,6 +616,163 @@ namespace x::Filesystem {
     }
 #pragma endregion
 
+#pragma region MappedFile
+#ifndef _WIN32
+    namespace {
+        // madvise wants a page-aligned start
+        void AdviseRange(std::span<const u8> range, int advice) {
+            if (range.empty()) { return; }
+            const auto pageSize = CAST<uintptr_t>(sysconf(_SC_PAGESIZE));
+            const auto start    = RCAST<uintptr_t>(range.data()) & ~(pageSize - 1);
+            const auto length   = RCAST<uintptr_t>(range.data()) + range.size() - start;
+            madvise(RCAST<void*>(start), length, advice);
+        }
+    }  // namespace
+#endif
+
+    MappedFile::MappedFile(const Path& path, AccessHint hint, bool hugePages) {
+#ifdef _WIN32
+        DWORD flags = FILE_ATTRIBUTE_NORMAL;
+        if (hint == AccessHint::Sequential) flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+        if (hint == AccessHint::Random) flags |= FILE_FLAG_RANDOM_ACCESS;
+        const HANDLE file =
+          CreateFileA(path.CStr(), GENERIC_READ, FILE_SHARE_READ, None, OPEN_EXISTING, flags, None);
+        if (file == INVALID_HANDLE_VALUE) { return; }
+
+        LARGE_INTEGER size {};
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            return;
+        }
+        _file = file;
+        _size = CAST<u64>(size.QuadPart);
+        _open = true;
+        if (_size == 0) { return; }
+
+        // Large pages can't back file mappings on Windows, so `hugePages` has no effect here
+        std::ignore = hugePages;
+        _mapping    = CreateFileMappingA(file, None, PAGE_READONLY, 0, 0, None);
+        if (!_mapping) {
+            Close();
+            return;
+        }
+        _data = CAST<const u8*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!_data) { Close(); }
+#else
+        const int fd = open(path.CStr(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) { return; }
+
+        struct stat info {};
+        if (fstat(fd, &info) != 0) {
+            close(fd);
+            return;
+        }
+        _size = CAST<u64>(info.st_size);
+        _open = true;
+        if (_size == 0) {
+            close(fd);
+            return;
+        }
+
+        void* data = mmap(None, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file
+        close(fd);
+        if (data == MAP_FAILED) {
+            _open = false;
+            _size = 0;
+            return;
+        }
+        _data = CAST<const u8*>(data);
+
+        if (hint != AccessHint::Normal) { Advise(hint); }
+    #ifdef MADV_HUGEPAGE
+        if (hugePages) { madvise(data, _size, MADV_HUGEPAGE); }
+    #else
+        std::ignore = hugePages;
+    #endif
+#endif
+    }
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            _data = std::exchange(other._data, None);
+            _size = std::exchange(other._size, 0);
+            _open = std::exchange(other._open, false);
+#ifdef _WIN32
+            _file    = std::exchange(other._file, None);
+            _mapping = std::exchange(other._mapping, None);
+#endif
+        }
+        return *this;
+    }
+
+    bool MappedFile::IsOpen() const {
+        return _open;
+    }
+
+    u64 MappedFile::Size() const {
+        return _size;
+    }
+
+    std::span<const u8> MappedFile::Data() const {
+        return {_data, CAST<size_t>(_data ? _size : 0)};
+    }
+
+    std::span<const u8> MappedFile::Slice(u64 offset, u64 size) const {
+        if (!_data || offset >= _size) { return {}; }
+        return {_data + offset, CAST<size_t>(std::min(size, _size - offset))};
+    }
+
+    void MappedFile::Advise(AccessHint hint, u64 offset, u64 size) const {
+#ifdef _WIN32
+        // Access pattern flags are fixed when the file is opened on Windows
+        std::ignore = hint;
+        std::ignore = offset;
+        std::ignore = size;
+#else
+        int advice = MADV_NORMAL;
+        if (hint == AccessHint::Sequential) advice = MADV_SEQUENTIAL;
+        if (hint == AccessHint::Random) advice = MADV_RANDOM;
+        AdviseRange(Slice(offset, size), advice);
+#endif
+    }
+
+    void MappedFile::Prefetch(u64 offset, u64 size) const {
+        const auto range = Slice(offset, size);
+        if (range.empty()) { return; }
+#ifdef _WIN32
+        WIN32_MEMORY_RANGE_ENTRY entry {CCAST<u8*>(range.data()), range.size()};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+#else
+        AdviseRange(range, MADV_WILLNEED);
+#endif
+    }
+
+    void MappedFile::Close() {
+#ifdef _WIN32
+        if (_data) { UnmapViewOfFile(_data); }
+        if (_mapping) { CloseHandle(_mapping); }
+        if (_file) { CloseHandle(_file); }
+        _mapping = None;
+        _file    = None;
+#else
+        if (_data) { munmap(CCAST<u8*>(_data), _size); }
+#endif
+        _data = None;
+        _size = 0;
+        _open = false;
+    }
+#pragma endregion
+
 #pragma region Path
     Path Path::Current() {
         char buffer[1024];
@@ -313,32 +785,35 @@ namespace x::Filesystem {
     Path Path::Parent() const {
         const size_t lastSeparator = path.find_last_of(PATH_SEPARATOR);
         if (lastSeparator == std::string::npos || lastSeparator == 0) {
-            return Path(std::to_string(PATH_SEPARATOR));
+            return Path(str(1, PATH_SEPARATOR));
         }
         return Path(path.substr(0, lastSeparator));
     }
 
     bool Path::Exists() const {
+        if (FindMounted(*this)) { return true; }
+        if (const auto cached = MetadataCache::Global().Lookup(path)) {
+            return cached->type != EntryType::None;
+        }
         struct stat info {};
         return stat(path.c_str(), &info) == 0;
     }
 
     bool Path::IsFile() const {
-        struct stat info {};
-        if (stat(path.c_str(), &info) != 0) {
-            std::perror(path.c_str());
-            return false;
+        if (FindMounted(*this)) { return true; }
+        if (const auto cached = MetadataCache::Global().Lookup(path)) {
+            return cached->type == EntryType::File;
         }
-        return S_ISREG(info.st_mode);
+        struct stat info {};
+        return stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
     }
 
     bool Path::IsDirectory() const {
-        struct stat info {};
-        if (stat(path.c_str(), &info) != 0) {
-            std::perror(path.c_str());
-            return false;
+        if (const auto cached = MetadataCache::Global().Lookup(path)) {
+            return cached->type == EntryType::Directory;
         }
-        return S_ISDIR(info.st_mode);
+        struct stat info {};
+        return stat(path.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
     }
 
     bool Path::HasExtension() const {
@@ -378,32 +853,54 @@ namespace x::Filesystem {
     }
 
     bool Path::Create() const {
-        if (Exists()) return true;
+        return MakeDirectory(path) != DirectoryResult::Failed;
+    }
+
+    bool Path::CreateAll() const {
+        // Optimistically create the leaf and only walk up while ancestors are missing, so an
+        // existing parent costs one mkdir instead of a stat per ancestor
+        switch (MakeDirectory(path)) {
+            case DirectoryResult::Created:
+            case DirectoryResult::Exists:
+                return true;
+            case DirectoryResult::ParentMissing:
+                if (Parent() == *this || !Parent().CreateAll()) { return false; }
+                return MakeDirectory(path) != DirectoryResult::Failed;
+            default:
+                return false;
+        }
+    }
+
+    Path::DirectoryResult Path::MakeDirectory(const str& path) {
+        if (const auto cached = MetadataCache::Global().Lookup(path)) {
+            if (cached->type == EntryType::Directory) { return DirectoryResult::Exists; }
+        }
 
 #ifdef _WIN32
         if (!CreateDirectoryA(path.c_str(), nullptr)) {
-            const DWORD error = GetLastError();
-            if (error != ERROR_ALREADY_EXISTS) { return false; }
+            switch (GetLastError()) {
+                case ERROR_ALREADY_EXISTS:
+                    return DirectoryResult::Exists;
+                case ERROR_PATH_NOT_FOUND:
+                    return DirectoryResult::ParentMissing;
+                default:
+                    return DirectoryResult::Failed;
+            }
         }
 #else
         if (mkdir(path.c_str(), 0755) != 0) {
-            if (errno != EEXIST) { return false; }
-        }
-#endif
-        return true;
-    }
-
-    bool Path::CreateAll() const {
-        if (Exists()) return true;
-
-        if (path != str(1, PATH_SEPARATOR)) {
-            Path parentPath = Parent();
-            if (!parentPath.Exists()) {
-                if (!parentPath.CreateAll()) return false;
+            switch (errno) {
+                case EEXIST:
+                    return DirectoryResult::Exists;
+                case ENOENT:
+                    return DirectoryResult::ParentMissing;
+                default:
+                    return DirectoryResult::Failed;
             }
         }
-
-        return Create();
+#endif
+        MetadataCache::Global().Invalidate(path);
+        return DirectoryResult::Created;
     }
 
     str Path::Join(const str& lhs, const str& rhs) {
@@ -414,13 +911,15 @@ namespace x::Filesystem {
     }
 
     str Path::Normalize(const str& rawPath) {
-        str result;
-        std::vector<str> parts;
+        // Segments point into rawPath, so only the result touches the heap
+        ScratchScope scratch;
+        std::pmr::vector<std::string_view> parts(scratch.Resource());
+        const std::string_view raw(rawPath);
         size_t start = 0;
-        while (start < rawPath.size()) {
-            size_t end = rawPath.find(PATH_SEPARATOR, start);
-            if (end == std::string::npos) { end = rawPath.size(); }
-            str part = rawPath.substr(start, end - start);
+        while (start < raw.size()) {
+            size_t end = raw.find(PATH_SEPARATOR, start);
+            if (end == std::string_view::npos) { end = raw.size(); }
+            const std::string_view part = raw.substr(start, end - start);
             if (part == ".." && !parts.empty() && parts.back() != "..") {
                 parts.pop_back();
             } else if (!part.empty() && part != ".") {
@@ -428,13 +927,17 @@ namespace x::Filesystem {
             }
             start = end + 1;
         }
-        for (const auto& part : parts) {
-            result += PATH_SEPARATOR + part;
+
+        str result;
+        result.reserve(rawPath.size() + 1);
+        for (const auto part : parts) {
+            result += PATH_SEPARATOR;
+            result += part;
         }
 
 #ifdef _WIN32
         // Remove the first '/' if Windows path
-        result = result.substr(1, result.size() - 1);
+        if (!result.empty()) { result.erase(0, 1); }
 #endif
 
         return result.empty() ? str(1, PATH_SEPARATOR) : result;
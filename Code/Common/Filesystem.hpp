@@ -5,11 +5,14 @@
 #pragma once
 
 #include "Types.hpp"
+#include "IoQueue.hpp"
+#include "Task.hpp"
 #include <fstream>
 #include <vector>
 #include <algorithm>
 #include <stdexcept>
 #include <future>
+#include <span>
 #ifdef _WIN32
     #include <direct.h>
     #define getcwd _getcwd
@@ -27,6 +30,8 @@ namespace x {
         public:
             static std::vector<u8> ReadAllBytes(const Path& path);
             static str ReadAllText(const Path& path);
+            // Splits on '\n' and drops one trailing '\r' per line, so CRLF and LF files give
+            // the same lines on every platform, packed or not.
             static std::vector<str> ReadAllLines(const Path& path);
             static std::vector<u8> ReadBlock(const Path& path, size_t size, u64 offset = 0);
             static size_t QueryFileSize(const Path& path);
@@ -40,46 +45,145 @@ namespace x {
             static bool WriteBlock(const Path& path, const std::vector<u8>& data, u64 offset = 0);
         };
 
+        // Requests run on IoQueue::Global(). A request cancelled before it starts stores
+        // IoCancelled in its future.
         class AsyncFileReader {
         public:
-            static std::future<std::vector<u8>> ReadAllBytes(const Path& path);
-            static std::future<str> ReadAllText(const Path& path);
-            static std::future<std::vector<str>> ReadAllLines(const Path& path);
             static std::future<std::vector<u8>>
-            ReadBlock(const Path& path, size_t size, u64 offset = 0);
+            ReadAllBytes(const Path& path,
+                         IoPriority priority            = IoPriority::Normal,
+                         const CancellationToken& token = {});
+            static std::future<str>
+            ReadAllText(const Path& path,
+                        IoPriority priority            = IoPriority::Normal,
+                        const CancellationToken& token = {});
+            static std::future<std::vector<str>>
+            ReadAllLines(const Path& path,
+                         IoPriority priority            = IoPriority::Normal,
+                         const CancellationToken& token = {});
+            static std::future<std::vector<u8>>
+            ReadBlock(const Path& path,
+                      size_t size,
+                      u64 offset                     = 0,
+                      IoPriority priority            = IoPriority::Normal,
+                      const CancellationToken& token = {});
 
         private:
             template<typename Func>
-            static auto runAsync(Func&& func) -> std::future<decltype(func())> {
-                using ReturnType = decltype(func());
-                auto task =
-                  std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Func>(func));
-                std::future<ReturnType> future = task->get_future();
-                std::thread([task]() { (*task)(); }).detach();
-                return future;
+            static auto runAsync(Func&& func, IoPriority priority, const CancellationToken& token)
+              -> std::future<decltype(func())> {
+                return IoQueue::Global().Submit(std::forward<Func>(func), priority, token);
             }
         };
 
         class AsyncFileWriter {
         public:
-            static std::future<bool> WriteAllBytes(const Path& path, const std::vector<u8>& data);
-            static std::future<bool> WriteAllText(const Path& path, const str& text);
-            static std::future<bool> WriteAllLines(const Path& path, const std::vector<str>& lines);
             static std::future<bool>
-            WriteBlock(const Path& path, const std::vector<u8>& data, u64 offset = 0);
+            WriteAllBytes(const Path& path,
+                          const std::vector<u8>& data,
+                          IoPriority priority            = IoPriority::Normal,
+                          const CancellationToken& token = {});
+            static std::future<bool>
+            WriteAllText(const Path& path,
+                         const str& text,
+                         IoPriority priority            = IoPriority::Normal,
+                         const CancellationToken& token = {});
+            static std::future<bool>
+            WriteAllLines(const Path& path,
+                          const std::vector<str>& lines,
+                          IoPriority priority            = IoPriority::Normal,
+                          const CancellationToken& token = {});
+            static std::future<bool>
+            WriteBlock(const Path& path,
+                       const std::vector<u8>& data,
+                       u64 offset                     = 0,
+                       IoPriority priority            = IoPriority::Normal,
+                       const CancellationToken& token = {});
+
+            // Ownership-taking overloads: the payload is moved into the request instead of
+            // copied, so the caller pays nothing for large buffers it no longer needs.
+            static std::future<bool>
+            WriteAllBytes(const Path& path,
+                          std::vector<u8>&& data,
+                          IoPriority priority            = IoPriority::Normal,
+                          const CancellationToken& token = {});
+            static std::future<bool>
+            WriteAllText(const Path& path,
+                         str&& text,
+                         IoPriority priority            = IoPriority::Normal,
+                         const CancellationToken& token = {});
+            static std::future<bool>
+            WriteAllLines(const Path& path,
+                          std::vector<str>&& lines,
+                          IoPriority priority            = IoPriority::Normal,
+                          const CancellationToken& token = {});
+            static std::future<bool>
+            WriteBlock(const Path& path,
+                       std::vector<u8>&& data,
+                       u64 offset                     = 0,
+                       IoPriority priority            = IoPriority::Normal,
+                       const CancellationToken& token = {});
 
         private:
             template<typename Func>
-            static auto runAsync(Func&& func) -> std::future<decltype(func())> {
-                using ReturnType = decltype(func());
-                auto task =
-                  std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Func>(func));
-                std::future<ReturnType> future = task->get_future();
-                std::thread([task]() { (*task)(); }).detach();
-                return future;
+            static auto runAsync(Func&& func, IoPriority priority, const CancellationToken& token)
+              -> std::future<decltype(func())> {
+                return IoQueue::Global().Submit(std::forward<Func>(func), priority, token);
             }
         };
 
+        // Coroutine counterparts of AsyncFileReader/AsyncFileWriter. The I/O runs on
+        // IoQueue::Global() and the awaiting coroutine resumes on `executor`, so a loader can
+        // chain dependent reads without parking a thread per request. Tasks are lazy and take
+        // their arguments by value; a request cancelled before it starts throws IoCancelled
+        // from the co_await.
+        class AwaitableFileReader {
+        public:
+            static Task<std::vector<u8>> ReadAllBytes(Path path,
+                                                      Executor& executor,
+                                                      IoPriority priority     = IoPriority::Normal,
+                                                      CancellationToken token = {});
+            static Task<str> ReadAllText(Path path,
+                                         Executor& executor,
+                                         IoPriority priority     = IoPriority::Normal,
+                                         CancellationToken token = {});
+            static Task<std::vector<str>> ReadAllLines(Path path,
+                                                       Executor& executor,
+                                                       IoPriority priority     = IoPriority::Normal,
+                                                       CancellationToken token = {});
+            static Task<std::vector<u8>> ReadBlock(Path path,
+                                                   size_t size,
+                                                   u64 offset,
+                                                   Executor& executor,
+                                                   IoPriority priority     = IoPriority::Normal,
+                                                   CancellationToken token = {});
+        };
+
+        class AwaitableFileWriter {
+        public:
+            static Task<bool> WriteAllBytes(Path path,
+                                            std::vector<u8> data,
+                                            Executor& executor,
+                                            IoPriority priority     = IoPriority::Normal,
+                                            CancellationToken token = {});
+            static Task<bool> WriteAllText(Path path,
+                                           str text,
+                                           Executor& executor,
+                                           IoPriority priority     = IoPriority::Normal,
+                                           CancellationToken token = {});
+            static Task<bool> WriteAllLines(Path path,
+                                            std::vector<str> lines,
+                                            Executor& executor,
+                                            IoPriority priority     = IoPriority::Normal,
+                                            CancellationToken token = {});
+            static Task<bool> WriteBlock(Path path,
+                                         std::vector<u8> data,
+                                         u64 offset,
+                                         Executor& executor,
+                                         IoPriority priority     = IoPriority::Normal,
+                                         CancellationToken token = {});
+        };
+
         class StreamReader {
         public:
             explicit StreamReader(const Path& path);
@@ -131,12 +235,63 @@ namespace x {
             std::ofstream _stream;
         };
 
+        // Read-only memory map of a whole file. Pages are faulted in lazily and shared with the
+        // OS page cache, so loaders can consume data in place without copying it to the heap.
+        class MappedFile {
+        public:
+            enum class AccessHint {
+                Normal,
+                Sequential,  // Aggressive read-ahead, pages dropped behind the reader
+                Random,      // No read-ahead
+            };
+
+            MappedFile() = default;
+            // `hugePages` requests transparent huge pages for the mapping where the OS and
+            // filesystem support them; it is a hint and silently ignored otherwise.
+            explicit MappedFile(const Path& path,
+                                AccessHint hint = AccessHint::Normal,
+                                bool hugePages  = false);
+            ~MappedFile();
+
+            MappedFile(const MappedFile&)            = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            MappedFile(MappedFile&&) noexcept;
+            MappedFile& operator=(MappedFile&&) noexcept;
+
+            // Empty files open successfully with an empty span.
+            bool IsOpen() const;
+            u64 Size() const;
+
+            std::span<const u8> Data() const;
+            // Clamped to the end of the file.
+            std::span<const u8> Slice(u64 offset, u64 size) const;
+
+            // Re-hints a range, e.g. when a loader switches from scanning an index to
+            // reading scattered entries.
+            void Advise(AccessHint hint, u64 offset = 0, u64 size = ~0ull) const;
+            // Starts paging a range in ahead of use.
+            void Prefetch(u64 offset, u64 size) const;
+
+            void Close();
+
+        private:
+            const u8* _data = None;
+            u64 _size       = 0;
+            bool _open      = false;
+#ifdef _WIN32
+            void* _file    = None;
+            void* _mapping = None;
+#endif
+        };
+
         class Path {
         public:
             explicit Path(const str& path) : path(Normalize(path)) {}
             static Path Current();
 
             [[nodiscard]] Path Parent() const;
+            // Answered from MetadataCache when it knows the path, from stat() otherwise.
             [[nodiscard]] bool Exists() const;
             [[nodiscard]] bool IsFile() const;
             [[nodiscard]] bool IsDirectory() const;
@@ -153,9 +308,12 @@ namespace x {
             [[nodiscard]] bool CreateAll() const;
 
         private:
+            enum class DirectoryResult { Created, Exists, ParentMissing, Failed };
+
             str path;
             static str Join(const str& lhs, const str& rhs);
             static str Normalize(const str& rawPath);
+            static DirectoryResult MakeDirectory(const str& path);
         };
     };  // namespace Filesystem
 }  // namespace x
@@ -0,0 +1,164 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace x {
+    namespace {
+        // Heap blocks are only guaranteed this much; larger alignments are padded inside them
+        constexpr size_t kBlockAlignment = alignof(std::max_align_t);
+
+        size_t AlignedOffset(const u8* base, size_t offset, size_t alignment) {
+            const auto address = RCAST<uintptr_t>(base) + offset;
+            return offset + ((alignment - address % alignment) % alignment);
+        }
+    }  // namespace
+
+#pragma region LinearArena
+    LinearArena::LinearArena(size_t blockSize, MemoryTag tag) : _tag(tag), _blockSize(blockSize) {}
+
+    LinearArena::~LinearArena() {
+        FreeBlocks();
+    }
+
+    void* LinearArena::Allocate(size_t bytes, size_t alignment) {
+        if (_current < _blocks.size()) {
+            const Block& block   = _blocks[_current];
+            const size_t aligned = AlignedOffset(block.memory, _offset, alignment);
+            if (aligned + bytes <= block.size) {
+                _offset = aligned + bytes;
+                _peak   = std::max(_peak, GetUsed());
+                return block.memory + aligned;
+            }
+        }
+        return AllocateSlow(bytes, alignment);
+    }
+
+    void LinearArena::Rewind(const Marker& marker) {
+        _current  = marker.block;
+        _offset   = marker.offset;
+        _consumed = marker.consumed;
+    }
+
+    void LinearArena::Reset() {
+        // One block as large as the whole chain fits anything the chain did
+        if (_blocks.size() > 1) {
+            const size_t capacity = GetCapacity();
+            FreeBlocks();
+            _blocks.push_back(
+              {CAST<u8*>(MemoryTracker::Allocate(_tag, capacity, kBlockAlignment)), capacity});
+        }
+        Rewind({});
+    }
+
+    size_t LinearArena::GetCapacity() const {
+        size_t capacity = 0;
+        for (const Block& block : _blocks) {
+            capacity += block.size;
+        }
+        return capacity;
+    }
+
+    void* LinearArena::AllocateSlow(size_t bytes, size_t alignment) {
+        const size_t needed = bytes + (alignment > kBlockAlignment ? alignment : 0);
+        if (!_blocks.empty()) {
+            // The rest of the current block stays unused until the arena rewinds past it
+            _consumed += _blocks[_current].size;
+            ++_current;
+        }
+        while (_current < _blocks.size() && _blocks[_current].size < needed) {
+            _consumed += _blocks[_current].size;
+            ++_current;
+        }
+        if (_current == _blocks.size()) {
+            const size_t size = std::max(_blockSize, needed);
+            _blocks.push_back(
+              {CAST<u8*>(MemoryTracker::Allocate(_tag, size, kBlockAlignment)), size});
+        }
+
+        const Block& block   = _blocks[_current];
+        const size_t aligned = AlignedOffset(block.memory, 0, alignment);
+        _offset              = aligned + bytes;
+        _peak                = std::max(_peak, GetUsed());
+        return block.memory + aligned;
+    }
+
+    void LinearArena::FreeBlocks() {
+        for (const Block& block : _blocks) {
+            MemoryTracker::Free(_tag, block.memory, block.size, kBlockAlignment);
+        }
+        _blocks.clear();
+    }
+#pragma endregion
+
+#pragma region FrameArena
+    FrameArena::FrameArena(size_t capacity)
+        : _memory(CAST<u8*>(
+            MemoryTracker::Allocate(MemoryTag::Transient, capacity, kBlockAlignment))),
+          _capacity(capacity) {}
+
+    FrameArena::~FrameArena() {
+        BeginFrame();
+        MemoryTracker::Free(MemoryTag::Transient, _memory, _capacity, kBlockAlignment);
+    }
+
+    FrameArena& FrameArena::Global() {
+        static FrameArena arena;
+        return arena;
+    }
+
+    void* FrameArena::Allocate(size_t bytes, size_t alignment) {
+        size_t offset = _offset.load(std::memory_order_relaxed);
+        while (true) {
+            const size_t aligned = AlignedOffset(_memory, offset, alignment);
+            if (aligned + bytes > _capacity) { break; }
+            if (_offset.compare_exchange_weak(
+                  offset, aligned + bytes, std::memory_order_relaxed)) {
+                return _memory + aligned;
+            }
+        }
+
+        void* memory = MemoryTracker::Allocate(MemoryTag::Transient, bytes, alignment);
+        std::lock_guard lock(_overflowMutex);
+        _overflow.push_back({memory, bytes, alignment});
+        _overflowBytes += bytes;
+        return memory;
+    }
+
+    void FrameArena::BeginFrame() {
+        FrameStats stats;
+        stats.used                = _offset.load(std::memory_order_relaxed) + _overflowBytes;
+        stats.capacity            = _capacity;
+        stats.overflowAllocations = CAST<u32>(_overflow.size());
+        _lastFrameStats           = stats;
+
+        for (const Overflow& overflow : _overflow) {
+            MemoryTracker::Free(
+              MemoryTag::Transient, overflow.memory, overflow.bytes, overflow.alignment);
+        }
+        _overflow.clear();
+        _overflowBytes = 0;
+        _offset.store(0, std::memory_order_relaxed);
+
+        if (stats.overflowAllocations > 0) {
+            // Overflow blocks carry no padding, so leave room for what the arena would add
+            const size_t capacity = std::bit_ceil(stats.used + stats.used / 8);
+            MemoryTracker::Free(MemoryTag::Transient, _memory, _capacity, kBlockAlignment);
+            _memory   = CAST<u8*>(
+              MemoryTracker::Allocate(MemoryTag::Transient, capacity, kBlockAlignment));
+            _capacity = capacity;
+        }
+    }
+#pragma endregion
+
+#pragma region ScratchScope
+    LinearArena& ScratchScope::Local() {
+        static thread_local LinearArena arena;
+        return arena;
+    }
+#pragma endregion
+}  // namespace x
@@ -0,0 +1,194 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "MemoryTracker.hpp"
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
+
+namespace x {
+    // Bump allocator over a chain of blocks. Deallocation is a no-op; memory comes back all at
+    // once through Rewind() or Reset(). Blocks are kept for reuse, and Reset() folds a chain
+    // into one block, so a workload that repeats stops touching the heap after its first pass.
+    // Usable as a std::pmr::memory_resource. Not thread-safe.
+    class LinearArena : public std::pmr::memory_resource {
+    public:
+        // A position to rewind to; everything allocated after it is released.
+        struct Marker {
+            u32 block       = 0;
+            size_t offset   = 0;
+            size_t consumed = 0;
+        };
+
+        explicit LinearArena(size_t blockSize = 64 << 10, MemoryTag tag = MemoryTag::Transient);
+        ~LinearArena() override;
+
+        LinearArena(const LinearArena&)            = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+        // Uninitialized storage for `count` objects.
+        template<typename T>
+        T* AllocateArray(size_t count) {
+            return CAST<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        Marker GetMarker() const {
+            return {_current, _offset, _consumed};
+        }
+
+        void Rewind(const Marker& marker);
+        void Reset();
+
+        // Bytes handed out since the last Reset(), including alignment padding and the unused
+        // tails of blocks that were skipped.
+        size_t GetUsed() const {
+            return _consumed + _offset;
+        }
+
+        size_t GetPeak() const {
+            return _peak;
+        }
+
+        size_t GetCapacity() const;
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            return Allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void*, size_t, size_t) override {}
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+    private:
+        struct Block {
+            u8* memory;
+            size_t size;
+        };
+
+        MemoryTag _tag;
+        size_t _blockSize;
+        vector<Block> _blocks;
+        u32 _current     = 0;
+        size_t _offset   = 0;
+        size_t _consumed = 0;  // Sizes of the blocks before _current
+        size_t _peak     = 0;
+
+        void* AllocateSlow(size_t bytes, size_t alignment);
+        void FreeBlocks();
+    };
+
+    // Memory that lives until the next BeginFrame(), for data handed between systems or
+    // threads within a frame. Allocate() is lock-free and thread-safe. When a frame outgrows
+    // the arena the excess comes from the heap, and the next BeginFrame() grows the arena so
+    // that frame would have fit.
+    class FrameArena : public std::pmr::memory_resource {
+    public:
+        struct FrameStats {
+            size_t used             = 0;  // Including overflow
+            size_t capacity         = 0;
+            u32 overflowAllocations = 0;
+        };
+
+        explicit FrameArena(size_t capacity = 1 << 20);
+        ~FrameArena() override;
+
+        FrameArena(const FrameArena&)            = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        static FrameArena& Global();
+
+        void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+        template<typename T>
+        T* AllocateArray(size_t count) {
+            return CAST<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        // Releases everything allocated during the previous frame. No other thread may be
+        // allocating or still using frame memory. Call once a frame, next to
+        // MemoryTracker::BeginFrame().
+        void BeginFrame();
+
+        // Figures for the frame closed by the last BeginFrame().
+        FrameStats GetLastFrameStats() const {
+            return _lastFrameStats;
+        }
+
+    protected:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            return Allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void*, size_t, size_t) override {}
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+    private:
+        struct Overflow {
+            void* memory;
+            size_t bytes;
+            size_t alignment;
+        };
+
+        u8* _memory;
+        size_t _capacity;
+        std::atomic<size_t> _offset {0};
+
+        std::mutex _overflowMutex;
+        vector<Overflow> _overflow;
+        size_t _overflowBytes = 0;
+
+        FrameStats _lastFrameStats;
+    };
+
+    // Rewinds the calling thread's scratch arena to where it was when the scope opened, so
+    // functions can build temporary arrays and strings without the heap:
+    //
+    //     ScratchScope scratch;
+    //     std::pmr::vector<SceneNode*> pending(scratch.Resource());
+    //
+    // Scopes nest. A container from an outer scope must not grow while an inner one is open,
+    // since the inner scope would release its new storage.
+    class ScratchScope {
+    public:
+        ScratchScope() : _arena(Local()), _marker(_arena.GetMarker()) {}
+
+        ~ScratchScope() {
+            _arena.Rewind(_marker);
+        }
+
+        ScratchScope(const ScratchScope&)            = delete;
+        ScratchScope& operator=(const ScratchScope&) = delete;
+
+        std::pmr::memory_resource* Resource() const {
+            return &_arena;
+        }
+
+        void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+            return _arena.Allocate(bytes, alignment);
+        }
+
+        template<typename T>
+        T* AllocateArray(size_t count) {
+            return _arena.AllocateArray<T>(count);
+        }
+
+        // The calling thread's scratch arena.
+        static LinearArena& Local();
+
+    private:
+        LinearArena& _arena;
+        LinearArena::Marker _marker;
+    };
+}  // namespace x
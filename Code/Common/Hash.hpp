@@ -0,0 +1,38 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <string_view>
+
+namespace x {
+    // 64-bit FNV-1a. Not cryptographic; used for content keys and lookup tables.
+    constexpr u64 kFnv64Offset = 0xcbf29ce484222325ull;
+    constexpr u64 kFnv64Prime  = 0x100000001b3ull;
+
+    constexpr u64 Fnv1a64(const u8* data, size_t size, u64 hash = kFnv64Offset) {
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= data[i];
+            hash *= kFnv64Prime;
+        }
+        return hash;
+    }
+
+    inline u64 Fnv1a64(const void* data, size_t size, u64 hash = kFnv64Offset) {
+        return Fnv1a64(CAST<const u8*>(data), size, hash);
+    }
+
+    constexpr u64 Fnv1a64(std::string_view text, u64 hash = kFnv64Offset) {
+        for (const char c : text) {
+            hash ^= CAST<u8>(c);
+            hash *= kFnv64Prime;
+        }
+        return hash;
+    }
+
+    constexpr u64 HashCombine(u64 seed, u64 value) {
+        return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+    }
+}  // namespace x
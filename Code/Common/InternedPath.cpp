@@ -0,0 +1,217 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "InternedPath.hpp"
+#include "Hash.hpp"
+#include "Panic.inl"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+namespace x::Filesystem {
+    namespace {
+        constexpr u32 kNoExtension = ~0u;
+
+        struct PathNode {
+            u32 parent = 0;
+            u32 depth  = 0;
+            u64 hash   = kFnv64Offset;
+            str full;
+            u32 nameOffset = 0;
+            u32 extension  = kNoExtension;  // Offset of the '.' in `full`
+
+            std::string_view Name() const {
+                return std::string_view(full).substr(nameOffset);
+            }
+        };
+
+        struct ChildKey {
+            u32 parent;
+            std::string_view name;
+
+            bool operator==(const ChildKey&) const = default;
+        };
+
+        struct ChildKeyHash {
+            size_t operator()(const ChildKey& key) const {
+                return HashCombine(key.parent, Fnv1a64(key.name));
+            }
+        };
+
+        // Nodes live in fixed-size chunks that never move, so readers index them without a
+        // lock and the string views used as map keys stay valid. Only interning a new
+        // component takes the exclusive lock.
+        class PathTable {
+        public:
+            static constexpr u32 kChunkBits = 12;
+            static constexpr u32 kChunkSize = 1u << kChunkBits;
+            static constexpr u32 kMaxChunks = 1u << 12;
+
+            static PathTable& Get() {
+                static PathTable table;
+                return table;
+            }
+
+            PathTable() {
+                PathNode& root  = Allocate();
+                root.full       = str(1, PATH_SEPARATOR);
+                root.nameOffset = CAST<u32>(root.full.size());
+            }
+
+            ~PathTable() {
+                for (auto& chunk : _chunks) {
+                    delete[] chunk.load(std::memory_order_relaxed);
+                }
+            }
+
+            const PathNode& Node(u32 id) const {
+                const PathNode* nodes = _chunks[id >> kChunkBits].load(std::memory_order_acquire);
+                return nodes[id & (kChunkSize - 1)];
+            }
+
+            u32 Child(u32 parent, std::string_view name) {
+                {
+                    std::shared_lock lock(_mutex);
+                    const auto it = _children.find({parent, name});
+                    if (it != _children.end()) { return it->second; }
+                }
+
+                std::unique_lock lock(_mutex);
+                const auto it = _children.find({parent, name});
+                if (it != _children.end()) { return it->second; }
+
+                const u32 id          = _count.load(std::memory_order_relaxed);
+                PathNode& node        = Allocate();
+                const PathNode& owner = Node(parent);
+                node.parent           = parent;
+                node.depth            = owner.depth + 1;
+                node.hash             = HashCombine(owner.hash, Fnv1a64(name));
+#ifdef _WIN32
+                // Path drops the leading separator on Windows
+                node.full = parent == 0 ? str(name) : owner.full + PATH_SEPARATOR + str(name);
+#else
+                node.full = parent == 0 ? owner.full + str(name)
+                                        : owner.full + PATH_SEPARATOR + str(name);
+#endif
+                node.nameOffset  = CAST<u32>(node.full.size() - name.size());
+                const size_t dot = name.find_last_of('.');
+                if (dot != std::string_view::npos) {
+                    node.extension = node.nameOffset + CAST<u32>(dot);
+                }
+
+                _children.emplace(ChildKey {parent, node.Name()}, id);
+                return id;
+            }
+
+            // Same rules as Path::Normalize, applied relative to `start`.
+            u32 Intern(u32 start, std::string_view path) {
+                u32 current  = start;
+                size_t begin = 0;
+                while (begin < path.size()) {
+                    size_t end = path.find(PATH_SEPARATOR, begin);
+                    if (end == std::string_view::npos) { end = path.size(); }
+                    const std::string_view part = path.substr(begin, end - begin);
+                    begin                       = end + 1;
+
+                    if (part.empty() || part == ".") { continue; }
+                    if (part == ".." && current != 0 && Node(current).Name() != "..") {
+                        current = Node(current).parent;
+                    } else {
+                        current = Child(current, part);
+                    }
+                }
+                return current;
+            }
+
+            size_t Count() const {
+                return _count.load(std::memory_order_acquire);
+            }
+
+        private:
+            std::array<std::atomic<PathNode*>, kMaxChunks> _chunks {};
+            std::atomic<u32> _count {0};
+            std::shared_mutex _mutex;
+            unordered_map<ChildKey, u32, ChildKeyHash> _children;
+
+            // Called with the exclusive lock held (or from the constructor).
+            PathNode& Allocate() {
+                const u32 id    = _count.load(std::memory_order_relaxed);
+                const u32 chunk = id >> kChunkBits;
+                if (chunk >= kMaxChunks) { Panic("Interned path table is full"); }
+                PathNode* nodes = _chunks[chunk].load(std::memory_order_relaxed);
+                if (!nodes) {
+                    nodes = new PathNode[kChunkSize];
+                    _chunks[chunk].store(nodes, std::memory_order_release);
+                }
+                _count.store(id + 1, std::memory_order_release);
+                return nodes[id & (kChunkSize - 1)];
+            }
+        };
+    }  // namespace
+
+    InternedPath::InternedPath(std::string_view path) : _id(PathTable::Get().Intern(0, path)) {}
+
+    InternedPath::InternedPath(const Path& path) : InternedPath(std::string_view(path.Str())) {}
+
+    InternedPath InternedPath::Parent() const {
+        return InternedPath(PathTable::Get().Node(_id).parent);
+    }
+
+    InternedPath InternedPath::Join(std::string_view subPath) const {
+        return InternedPath(PathTable::Get().Intern(_id, subPath));
+    }
+
+    InternedPath InternedPath::operator/(std::string_view subPath) const {
+        return Join(subPath);
+    }
+
+    InternedPath InternedPath::ReplaceExtension(std::string_view ext) const {
+        if (IsRoot()) { return *this; }
+        const PathNode& node = PathTable::Get().Node(_id);
+        const std::string_view stem =
+          node.extension == kNoExtension
+            ? node.Name()
+            : std::string_view(node.full).substr(node.nameOffset, node.extension - node.nameOffset);
+        return InternedPath(PathTable::Get().Child(node.parent, str(stem) + "." + str(ext)));
+    }
+
+    std::string_view InternedPath::Filename() const {
+        return PathTable::Get().Node(_id).Name();
+    }
+
+    bool InternedPath::HasExtension() const {
+        return PathTable::Get().Node(_id).extension != kNoExtension;
+    }
+
+    std::string_view InternedPath::Extension() const {
+        const PathNode& node = PathTable::Get().Node(_id);
+        if (node.extension == kNoExtension) { return {}; }
+        return std::string_view(node.full).substr(node.extension + 1);
+    }
+
+    u32 InternedPath::Depth() const {
+        return PathTable::Get().Node(_id).depth;
+    }
+
+    std::string_view InternedPath::Str() const {
+        return PathTable::Get().Node(_id).full;
+    }
+
+    const char* InternedPath::CStr() const {
+        return PathTable::Get().Node(_id).full.c_str();
+    }
+
+    Path InternedPath::ToPath() const {
+        return Path(PathTable::Get().Node(_id).full);
+    }
+
+    u64 InternedPath::Hash() const {
+        return PathTable::Get().Node(_id).hash;
+    }
+
+    size_t InternedPath::GetInternedCount() {
+        return PathTable::Get().Count();
+    }
+}  // namespace x::Filesystem
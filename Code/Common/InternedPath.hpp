@@ -0,0 +1,67 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include <functional>
+#include <string_view>
+
+namespace x::Filesystem {
+    // Handle to a normalized path stored once in a process-wide table. Each path is a node
+    // holding its parent, last component, full string and a 64-bit hash built component by
+    // component, so equality is an id compare and Parent/Filename/Extension/Hash are O(1).
+    // Normalization follows Path exactly (Str() matches Path::Str()) and runs only the first
+    // time a path is seen; interning an already-known path doesn't allocate. Interned paths
+    // are never freed, which suits asset and config paths, not arbitrary user input.
+    class InternedPath {
+    public:
+        // The root path.
+        InternedPath() = default;
+        explicit InternedPath(std::string_view path);
+        explicit InternedPath(const Path& path);
+
+        [[nodiscard]] InternedPath Parent() const;
+        [[nodiscard]] InternedPath Join(std::string_view subPath) const;
+        [[nodiscard]] InternedPath operator/(std::string_view subPath) const;
+        [[nodiscard]] InternedPath ReplaceExtension(std::string_view ext) const;
+
+        [[nodiscard]] bool IsRoot() const {
+            return _id == 0;
+        }
+
+        [[nodiscard]] std::string_view Filename() const;
+        [[nodiscard]] bool HasExtension() const;
+        [[nodiscard]] std::string_view Extension() const;
+        [[nodiscard]] u32 Depth() const;
+
+        [[nodiscard]] std::string_view Str() const;
+        [[nodiscard]] const char* CStr() const;
+        [[nodiscard]] Path ToPath() const;
+
+        // Stable across runs (derived from the components, not the id).
+        [[nodiscard]] u64 Hash() const;
+
+        [[nodiscard]] u32 GetId() const {
+            return _id;
+        }
+
+        bool operator==(const InternedPath& other) const = default;
+
+        static size_t GetInternedCount();
+
+    private:
+        explicit InternedPath(u32 id) : _id(id) {}
+
+        u32 _id = 0;
+    };
+}  // namespace x::Filesystem
+
+template<>
+struct std::hash<x::Filesystem::InternedPath> {
+    size_t operator()(const x::Filesystem::InternedPath& path) const noexcept {
+        return path.Hash();
+    }
+};
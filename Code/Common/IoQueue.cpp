@@ -0,0 +1,355 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "IoQueue.hpp"
+#include "IoUring.hpp"
+#include "Filesystem.hpp"
+#include "MemoryTracker.hpp"
+#include "PackArchive.hpp"
+#include "Profiler.hpp"
+
+#ifndef _WIN32
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace x {
+    IoQueue::IoQueue(u32 workerCount, bool useIoUring) {
+        if (workerCount == 0) workerCount = 1;
+        if (useIoUring) {
+            _ring = make_unique<IoUring>();
+            if (_ring->Initialize(kRingEntries)) {
+                _ringAvailable.store(true, std::memory_order_relaxed);
+                _ringThread = std::thread([this]() { RingLoop(); });
+            } else {
+                _ring.reset();
+            }
+        }
+        _workers.reserve(workerCount);
+        for (u32 i = 0; i < workerCount; ++i) {
+            _workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    IoQueue::~IoQueue() {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _workAvailable.notify_all();
+        _readsAvailable.notify_all();
+        for (auto& worker : _workers) {
+            if (worker.joinable()) worker.join();
+        }
+        if (_ringThread.joinable()) _ringThread.join();
+    }
+
+    IoQueue& IoQueue::Global() {
+        static IoQueue queue;
+        return queue;
+    }
+
+    std::future<vector<u8>> IoQueue::Read(const Filesystem::Path& path,
+                                          u64 offset,
+                                          size_t size,
+                                          IoPriority priority,
+                                          const CancellationToken& token) {
+        auto promise = make_shared<std::promise<vector<u8>>>();
+        auto future  = promise->get_future();
+        Read(path, offset, size, priority, token, [promise](vector<u8>&& data, bool cancelled) {
+            if (cancelled) {
+                promise->set_exception(std::make_exception_ptr(IoCancelled()));
+            } else {
+                promise->set_value(std::move(data));
+            }
+        });
+        return future;
+    }
+
+    void IoQueue::Read(const Filesystem::Path& path,
+                       u64 offset,
+                       size_t size,
+                       IoPriority priority,
+                       const CancellationToken& token,
+                       ReadCallback onComplete) {
+        if (auto packed = Filesystem::FindMounted(path)) {
+            // Already mapped; copying on a worker beats a round trip through the ring
+            const auto read = [packed = std::move(*packed), offset, size, onComplete]() {
+                onComplete(size == 0 ? vector<u8>(packed.data.begin(), packed.data.end())
+                                     : packed.ReadBlock(offset, size),
+                           false);
+            };
+            Post(read, [onComplete]() { onComplete({}, true); }, priority, token);
+            return;
+        }
+
+        ReadJob read {path.Str(), offset, size, std::move(onComplete), token};
+        bool queued = false;
+        {
+            // Checked under the lock so a read can't be queued after the ring thread fails
+            // over and stops taking them
+            std::lock_guard lock(_mutex);
+            if (_ringAvailable.load(std::memory_order_relaxed)) {
+                _reads.Push(priority, std::move(read));
+                queued = true;
+            }
+        }
+        if (queued) {
+            _readsAvailable.notify_one();
+            return;
+        }
+        Job job = ToBlockingRead(std::move(read));
+        Post(std::move(job.run), std::move(job.cancel), priority, job.token);
+    }
+
+    void IoQueue::Post(std::function<void()> run,
+                       std::function<void()> cancel,
+                       IoPriority priority,
+                       const CancellationToken& token) {
+        {
+            std::lock_guard lock(_mutex);
+            _jobs.Push(priority, {std::move(run), std::move(cancel), token});
+        }
+        _workAvailable.notify_one();
+    }
+
+    void IoQueue::WaitIdle() {
+        std::unique_lock lock(_mutex);
+        _idle.wait(lock, [this]() { return _jobs.Empty() && _reads.Empty() && _active == 0; });
+    }
+
+    void IoQueue::WorkerLoop() {
+        X_PROFILE_THREAD("IoQueue");
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock lock(_mutex);
+                _workAvailable.wait(lock, [this]() { return _stopping || !_jobs.Empty(); });
+                if (_jobs.Empty()) return;  // Only reached when stopping
+                job = _jobs.Pop();
+                ++_active;
+            }
+
+            if (job.token.IsCancelled()) {
+                job.cancel();
+            } else {
+                X_PROFILE_SCOPE("IoQueue::Job");
+                const MemoryScope memoryScope(MemoryTag::FileBuffers);
+                job.run();
+            }
+            FinishActive(1);
+        }
+    }
+
+    void IoQueue::FinishActive(u32 count) {
+        std::lock_guard lock(_mutex);
+        _active -= count;
+        // Notify under the lock; a waiter may destroy the queue as soon as it sees idle
+        if (_jobs.Empty() && _reads.Empty() && _active == 0) _idle.notify_all();
+    }
+
+    IoQueue::Job IoQueue::ToBlockingRead(ReadJob&& read) {
+        const auto run = [path = std::move(read.path),
+                          offset     = read.offset,
+                          size       = read.size,
+                          onComplete = read.onComplete]() {
+            onComplete(ReadBlocking(path, offset, size), false);
+        };
+        const auto cancel = [onComplete = std::move(read.onComplete)]() { onComplete({}, true); };
+        return {run, cancel, std::move(read.token)};
+    }
+
+    vector<u8> IoQueue::ReadBlocking(const str& path, u64 offset, size_t size) {
+        const Filesystem::Path filePath(path);
+        if (size == 0) { return Filesystem::FileReader::ReadAllBytes(filePath); }
+        return Filesystem::FileReader::ReadBlock(filePath, size, offset);
+    }
+
+#ifdef __linux__
+    void IoQueue::RingLoop() {
+        // Reads larger than this are split across several submissions
+        static constexpr u64 kMaxChunk = 1ull << 30;
+
+        struct InFlight {
+            ReadJob job;
+            i32 fd;
+            vector<u8> buffer;
+            u64 offset;
+            u64 done;
+        };
+
+        vector<InFlight> slots(_ring->GetEntryCount());
+        vector<u32> freeSlots;
+        for (u32 i = 0; i < slots.size(); ++i) {
+            freeSlots.push_back(CAST<u32>(slots.size()) - 1 - i);
+        }
+
+        const auto prepareNext = [this, &slots](u32 slot) {
+            InFlight& read = slots[slot];
+            const u64 size = std::min<u64>(read.buffer.size() - read.done, kMaxChunk);
+            // A slot never has more than one read queued, so the ring can't be full
+            _ring->PrepareRead(read.fd,
+                               read.buffer.data() + read.done,
+                               CAST<u32>(size),
+                               read.offset + read.done,
+                               slot);
+        };
+
+        const auto complete = [this, &slots, &freeSlots](u32 slot, bool success) {
+            InFlight& read = slots[slot];
+            close(read.fd);
+            if (!success) { read.buffer.clear(); }
+            read.job.onComplete(std::move(read.buffer), false);
+            read = {};
+            freeSlots.push_back(slot);
+            FinishActive(1);
+        };
+
+        // Called when a submission fails. From then on reads go to the workers, and the ring
+        // thread finishes the reads it holds with blocking reads and exits.
+        const auto failOver = [this, &slots, &complete]() {
+            {
+                std::lock_guard lock(_mutex);
+                _ringAvailable.store(false, std::memory_order_relaxed);
+                for (u32 priority = 0; priority < 3; ++priority) {
+                    for (auto& read : _reads.queues[priority]) {
+                        _jobs.Push(CAST<IoPriority>(priority), ToBlockingRead(std::move(read)));
+                    }
+                    _reads.queues[priority].clear();
+                }
+            }
+            _workAvailable.notify_all();
+
+            // Every occupied slot has exactly one read queued or running in the kernel, which
+            // may still write into the slot's buffer and will post a completion for the slot.
+            // Nothing can be freed or reused until all of those have come back.
+            static constexpr u64 kCancelTag   = 1ull << 63;
+            static constexpr u32 kMaxAttempts = 64;
+            vector<bool> outstanding(slots.size());
+            u32 remaining = 0;
+            for (u32 slot = 0; slot < slots.size(); ++slot) {
+                outstanding[slot] = CAST<bool>(slots[slot].job.onComplete);
+                remaining += outstanding[slot] ? 1 : 0;
+            }
+
+            u32 nextCancel = 0;
+            for (u32 failures = 0; remaining > 0 && failures < kMaxAttempts;) {
+                while (nextCancel < slots.size() &&
+                       (!outstanding[nextCancel] ||
+                        _ring->PrepareCancel(nextCancel, kCancelTag | nextCancel))) {
+                    ++nextCancel;
+                }
+                if (!_ring->Submit(1)) { ++failures; }
+                _ring->ReapCompletions([&](const IoUring::Completion& completion) {
+                    if ((completion.userData & kCancelTag) != 0) { return; }
+                    const auto slot = CAST<u32>(completion.userData);
+                    if (outstanding[slot]) {
+                        outstanding[slot] = false;
+                        --remaining;
+                    }
+                });
+            }
+
+            for (u32 slot = 0; slot < slots.size(); ++slot) {
+                InFlight& read = slots[slot];
+                if (!read.job.onComplete) { continue; }
+                if (outstanding[slot]) {
+                    // The kernel never confirmed this read, so its buffer is given up rather
+                    // than freed under it
+                    new vector<u8>(std::move(read.buffer));
+                }
+                read.buffer = ReadBlocking(read.job.path, read.job.offset, read.job.size);
+                complete(slot, true);
+            }
+            _ring.reset();
+        };
+
+        for (;;) {
+            vector<ReadJob> batch;
+            {
+                std::unique_lock lock(_mutex);
+                const u32 inFlight = CAST<u32>(slots.size() - freeSlots.size());
+                if (inFlight == 0) {
+                    _readsAvailable.wait(lock, [this]() { return _stopping || !_reads.Empty(); });
+                    if (_reads.Empty()) return;  // Only reached when stopping
+                }
+                while (batch.size() < freeSlots.size() && !_reads.Empty()) {
+                    batch.push_back(_reads.Pop());
+                }
+                _active += CAST<u32>(batch.size());
+            }
+
+            for (auto& job : batch) {
+                if (job.token.IsCancelled()) {
+                    job.onComplete({}, true);
+                    FinishActive(1);
+                    continue;
+                }
+
+                const i32 fd = open(job.path.c_str(), O_RDONLY | O_CLOEXEC);
+                struct stat info {};
+                if (fd < 0 || fstat(fd, &info) != 0) {
+                    if (fd >= 0) close(fd);
+                    job.onComplete({}, false);
+                    FinishActive(1);
+                    continue;
+                }
+
+                // Same range rules as FileReader::ReadAllBytes / ReadBlock
+                const auto fileSize = CAST<u64>(info.st_size);
+                u64 offset          = job.offset;
+                u64 size            = job.size;
+                if (size == 0) {
+                    offset = 0;
+                    size   = fileSize;
+                } else if (offset >= fileSize || offset + size > fileSize) {
+                    size = 0;
+                }
+                if (size == 0) {
+                    close(fd);
+                    job.onComplete({}, false);
+                    FinishActive(1);
+                    continue;
+                }
+
+                const u32 slot = freeSlots.back();
+                freeSlots.pop_back();
+                const MemoryScope memoryScope(MemoryTag::FileBuffers);
+                slots[slot] = {std::move(job), fd, vector<u8>(size), offset, 0};
+                prepareNext(slot);
+            }
+
+            if (slots.size() == freeSlots.size()) { continue; }
+
+            const bool submitted = _ring->Submit(1);
+            if (!submitted || _failNextSubmit.exchange(false, std::memory_order_relaxed)) {
+                failOver();
+                return;
+            }
+
+            _ring->ReapCompletions([&](const IoUring::Completion& completion) {
+                const auto slot = CAST<u32>(completion.userData);
+                InFlight& read  = slots[slot];
+                if (completion.result == -EINTR || completion.result == -EAGAIN) {
+                    prepareNext(slot);
+                } else if (completion.result <= 0) {
+                    // Error, or the file shrank underneath us
+                    complete(slot, false);
+                } else {
+                    read.done += CAST<u64>(completion.result);
+                    if (read.done < read.buffer.size()) {
+                        prepareNext(slot);
+                    } else {
+                        complete(slot, true);
+                    }
+                }
+            });
+        }
+    }
+#else
+    void IoQueue::RingLoop() {}
+#endif
+}  // namespace x
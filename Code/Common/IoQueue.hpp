@@ -0,0 +1,199 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace x {
+    namespace Filesystem {
+        class Path;
+    }
+
+    enum class IoPriority : u8 {
+        High,
+        Normal,
+        Low,
+    };
+
+    // Shared flag checked before a queued request starts. Cancelling never interrupts a
+    // request that is already running.
+    class CancellationToken {
+    public:
+        CancellationToken() : _cancelled(make_shared<std::atomic<bool>>(false)) {}
+
+        void Cancel() const {
+            _cancelled->store(true, std::memory_order_relaxed);
+        }
+
+        bool IsCancelled() const {
+            return _cancelled->load(std::memory_order_relaxed);
+        }
+
+    private:
+        shared_ptr<std::atomic<bool>> _cancelled;
+    };
+
+    // Stored in the future of a request cancelled before it ran.
+    class IoCancelled : public std::runtime_error {
+    public:
+        IoCancelled() : std::runtime_error("I/O request cancelled") {}
+    };
+
+    class IoUring;
+
+    // Fixed set of I/O workers fed from a priority queue (FIFO within a priority). Reads
+    // submitted through Read() are batched into io_uring when the kernel supports it, which
+    // keeps many requests in flight from a single thread; everything else, and all reads when
+    // io_uring is unavailable, run on the workers. If the ring fails at runtime it is torn
+    // down once the kernel has let go of every buffer, and later reads go to the workers.
+    class IoQueue {
+    public:
+        static constexpr u32 kDefaultWorkerCount = 4;
+        static constexpr u32 kRingEntries        = 64;
+
+        // Invoked on an I/O thread with the data, or with `cancelled` set if the request was
+        // cancelled before it started.
+        using ReadCallback = std::function<void(vector<u8>&& data, bool cancelled)>;
+
+        explicit IoQueue(u32 workerCount = kDefaultWorkerCount, bool useIoUring = true);
+        ~IoQueue();
+
+        IoQueue(const IoQueue&)            = delete;
+        IoQueue& operator=(const IoQueue&) = delete;
+
+        // Process-wide queue used by AsyncFileReader/AsyncFileWriter.
+        static IoQueue& Global();
+
+        template<typename Func>
+        auto Submit(Func&& func,
+                    IoPriority priority            = IoPriority::Normal,
+                    const CancellationToken& token = {}) -> std::future<decltype(func())> {
+            using ReturnType = decltype(func());
+            auto promise     = make_shared<std::promise<ReturnType>>();
+            auto future      = promise->get_future();
+            Post(
+              [promise, func = std::forward<Func>(func)]() mutable {
+                  try {
+                      if constexpr (std::is_void_v<ReturnType>) {
+                          func();
+                          promise->set_value();
+                      } else {
+                          promise->set_value(func());
+                      }
+                  } catch (...) { promise->set_exception(std::current_exception()); }
+              },
+              [promise]() { promise->set_exception(std::make_exception_ptr(IoCancelled())); },
+              priority,
+              token);
+            return future;
+        }
+
+        // Reads `size` bytes at `offset`, or the whole file when `size` is 0. Like FileReader,
+        // an unreadable file or out-of-range block yields an empty vector.
+        std::future<vector<u8>> Read(const Filesystem::Path& path,
+                                     u64 offset                     = 0,
+                                     size_t size                    = 0,
+                                     IoPriority priority            = IoPriority::Normal,
+                                     const CancellationToken& token = {});
+        void Read(const Filesystem::Path& path,
+                  u64 offset,
+                  size_t size,
+                  IoPriority priority,
+                  const CancellationToken& token,
+                  ReadCallback onComplete);
+
+        // Runs `run` on a worker, or `cancel` instead if the token fires before it starts.
+        void Post(std::function<void()> run,
+                  std::function<void()> cancel,
+                  IoPriority priority            = IoPriority::Normal,
+                  const CancellationToken& token = {});
+
+        // Blocks until every queued and running request has finished.
+        void WaitIdle();
+
+        bool IsUsingIoUring() const {
+            return _ringAvailable.load(std::memory_order_relaxed);
+        }
+
+        // Makes the ring's next submission report failure after the kernel has taken the
+        // reads, as a failing io_uring_enter would. Lets tests drive the fallback path.
+        void SimulateRingFailure() {
+            _failNextSubmit.store(true, std::memory_order_relaxed);
+        }
+
+        u32 GetWorkerCount() const {
+            return CAST<u32>(_workers.size());
+        }
+
+    private:
+        struct Job {
+            std::function<void()> run;
+            std::function<void()> cancel;
+            CancellationToken token;
+        };
+
+        struct ReadJob {
+            str path;
+            u64 offset;
+            size_t size;
+            ReadCallback onComplete;
+            CancellationToken token;
+        };
+
+        template<typename T>
+        struct PriorityQueue {
+            std::deque<T> queues[3];
+
+            void Push(IoPriority priority, T&& item) {
+                queues[CAST<u32>(priority)].push_back(std::move(item));
+            }
+
+            bool Empty() const {
+                return queues[0].empty() && queues[1].empty() && queues[2].empty();
+            }
+
+            T Pop() {
+                for (auto& queue : queues) {
+                    if (!queue.empty()) {
+                        T item = std::move(queue.front());
+                        queue.pop_front();
+                        return item;
+                    }
+                }
+                return {};
+            }
+        };
+
+        vector<std::thread> _workers;
+        std::thread _ringThread;
+        unique_ptr<IoUring> _ring;  // Only touched by the ring thread once it starts
+        std::atomic<bool> _ringAvailable {false};  // Written under _mutex
+        std::atomic<bool> _failNextSubmit {false};
+
+        std::mutex _mutex;
+        std::condition_variable _workAvailable;
+        std::condition_variable _readsAvailable;
+        std::condition_variable _idle;
+        PriorityQueue<Job> _jobs;
+        PriorityQueue<ReadJob> _reads;
+        u32 _active    = 0;
+        bool _stopping = false;
+
+        void WorkerLoop();
+        void RingLoop();
+        void FinishActive(u32 count);
+
+        static Job ToBlockingRead(ReadJob&& read);
+        static vector<u8> ReadBlocking(const str& path, u64 offset, size_t size);
+    };
+}  // namespace x
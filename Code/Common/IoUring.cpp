@@ -0,0 +1,181 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "IoUring.hpp"
+
+#ifdef __linux__
+    #include <algorithm>
+    #include <atomic>
+    #include <cerrno>
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace x {
+#ifdef __linux__
+    namespace {
+        i32 SetupRing(u32 entries, io_uring_params* params) {
+            return CAST<i32>(syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        i32 EnterRing(i32 fd, u32 toSubmit, u32 minComplete, u32 flags) {
+            return CAST<i32>(
+              syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, None, 0));
+        }
+
+        void* MapRing(i32 fd, size_t size, u64 offset) {
+            void* ring =
+              mmap(None, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+            return ring == MAP_FAILED ? None : ring;
+        }
+
+        template<typename T>
+        T* Offset(void* base, u32 offset) {
+            return RCAST<T*>(CAST<u8*>(base) + offset);
+        }
+
+        // The kernel reads and writes the ring indices concurrently with us
+        u32 LoadAcquire(u32* value) {
+            return std::atomic_ref<u32>(*value).load(std::memory_order_acquire);
+        }
+
+        void StoreRelease(u32* value, u32 newValue) {
+            std::atomic_ref<u32>(*value).store(newValue, std::memory_order_release);
+        }
+    }  // namespace
+
+    IoUring::~IoUring() {
+        Destroy();
+    }
+
+    bool IoUring::Initialize(u32 entries) {
+        io_uring_params params {};
+        const i32 fd = SetupRing(entries, &params);
+        if (fd < 0) { return false; }
+        _ringFd  = fd;
+        _entries = params.sq_entries;
+
+        // IORING_OP_READ arrived in 5.6; FAST_POLL (5.7) is the nearest feature bit to test
+        if ((params.features & IORING_FEAT_FAST_POLL) == 0) {
+            Destroy();
+            return false;
+        }
+
+        _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) { _sqRingSize = _cqRingSize = std::max(_sqRingSize, _cqRingSize); }
+
+        _sqRing   = MapRing(fd, _sqRingSize, IORING_OFF_SQ_RING);
+        _cqRing   = singleMap ? _sqRing : MapRing(fd, _cqRingSize, IORING_OFF_CQ_RING);
+        _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        _sqes     = MapRing(fd, _sqesSize, IORING_OFF_SQES);
+        if (!_sqRing || !_cqRing || !_sqes) {
+            Destroy();
+            return false;
+        }
+
+        _sqHead  = Offset<u32>(_sqRing, params.sq_off.head);
+        _sqTail  = Offset<u32>(_sqRing, params.sq_off.tail);
+        _sqMask  = Offset<u32>(_sqRing, params.sq_off.ring_mask);
+        _sqArray = Offset<u32>(_sqRing, params.sq_off.array);
+        _cqHead  = Offset<u32>(_cqRing, params.cq_off.head);
+        _cqTail  = Offset<u32>(_cqRing, params.cq_off.tail);
+        _cqMask  = Offset<u32>(_cqRing, params.cq_off.ring_mask);
+        _cqes    = Offset<void>(_cqRing, params.cq_off.cqes);
+        return true;
+    }
+
+    bool IoUring::PrepareRead(i32 fd, void* buffer, u32 size, u64 offset, u64 userData) {
+        return Prepare(IORING_OP_READ, fd, RCAST<u64>(buffer), size, offset, userData);
+    }
+
+    bool IoUring::PrepareCancel(u64 target, u64 userData) {
+        return Prepare(IORING_OP_ASYNC_CANCEL, -1, target, 0, 0, userData);
+    }
+
+    bool IoUring::Prepare(u8 opcode, i32 fd, u64 address, u32 size, u64 offset, u64 userData) {
+        const u32 tail = *_sqTail;
+        if (tail - LoadAcquire(_sqHead) >= _entries) { return false; }
+
+        const u32 index   = tail & *_sqMask;
+        io_uring_sqe& sqe = CAST<io_uring_sqe*>(_sqes)[index];
+        sqe               = {};
+        sqe.opcode        = opcode;
+        sqe.fd            = fd;
+        sqe.addr          = address;
+        sqe.len           = size;
+        sqe.off           = offset;
+        sqe.user_data     = userData;
+        _sqArray[index]   = index;
+        StoreRelease(_sqTail, tail + 1);
+        ++_pending;
+        return true;
+    }
+
+    bool IoUring::Submit(u32 minComplete) {
+        const u32 flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+        for (;;) {
+            const i32 result = EnterRing(_ringFd, _pending, minComplete, flags);
+            if (result >= 0) {
+                _pending -= std::min<u32>(_pending, CAST<u32>(result));
+                return true;
+            }
+            if (errno != EINTR) { return false; }
+        }
+    }
+
+    bool IoUring::PopCompletion(Completion& completion) {
+        const u32 head = *_cqHead;
+        if (head == LoadAcquire(_cqTail)) { return false; }
+        const io_uring_cqe& cqe = CAST<io_uring_cqe*>(_cqes)[head & *_cqMask];
+        completion              = {cqe.user_data, cqe.res};
+        StoreRelease(_cqHead, head + 1);
+        return true;
+    }
+
+    void IoUring::Destroy() {
+        if (_sqes) { munmap(_sqes, _sqesSize); }
+        if (_cqRing && _cqRing != _sqRing) { munmap(_cqRing, _cqRingSize); }
+        if (_sqRing) { munmap(_sqRing, _sqRingSize); }
+        if (_ringFd >= 0) { close(_ringFd); }
+        _sqes    = None;
+        _cqRing  = None;
+        _sqRing  = None;
+        _ringFd  = -1;
+        _entries = 0;
+        _pending = 0;
+    }
+#else
+    IoUring::~IoUring() = default;
+
+    bool IoUring::Initialize(u32) {
+        return false;
+    }
+
+    bool IoUring::PrepareRead(i32, void*, u32, u64, u64) {
+        return false;
+    }
+
+    bool IoUring::PrepareCancel(u64, u64) {
+        return false;
+    }
+
+    bool IoUring::Prepare(u8, i32, u64, u32, u64, u64) {
+        return false;
+    }
+
+    bool IoUring::Submit(u32) {
+        return false;
+    }
+
+    bool IoUring::PopCompletion(Completion&) {
+        return false;
+    }
+
+    void IoUring::Destroy() {}
+#endif
+}  // namespace x
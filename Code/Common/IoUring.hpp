@@ -0,0 +1,84 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+namespace x {
+    // Minimal io_uring wrapper over the raw syscalls (no liburing dependency). Only what the
+    // IoQueue needs: positional reads and completion reaping, driven from one thread.
+    // Initialize() fails on non-Linux platforms, kernels older than 5.7, or when the syscalls
+    // are blocked (e.g. by a seccomp profile); callers fall back to blocking reads.
+    class IoUring {
+    public:
+        struct Completion {
+            u64 userData;
+            i32 result;  // Bytes read, or -errno
+        };
+
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring&)            = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        bool Initialize(u32 entries);
+        bool IsInitialized() const {
+            return _ringFd >= 0;
+        }
+
+        // Queues a read; returns false when the submission queue is full.
+        bool PrepareRead(i32 fd, void* buffer, u32 size, u64 offset, u64 userData);
+
+        // Queues a cancel of the request tagged `target`. The cancel posts its own completion
+        // tagged `userData`; the target still posts one, with -ECANCELED if it was stopped.
+        bool PrepareCancel(u64 target, u64 userData);
+
+        // Submits queued reads and waits until at least `minComplete` completions are
+        // available. Returns false on a syscall error.
+        bool Submit(u32 minComplete = 0);
+
+        // Calls `func(const Completion&)` for every available completion; returns the count.
+        template<typename Func>
+        u32 ReapCompletions(Func&& func) {
+            u32 count = 0;
+            Completion completion {};
+            while (PopCompletion(completion)) {
+                func(completion);
+                ++count;
+            }
+            return count;
+        }
+
+        u32 GetEntryCount() const {
+            return _entries;
+        }
+
+    private:
+        i32 _ringFd  = -1;
+        u32 _entries = 0;
+        u32 _pending = 0;  // Prepared but not yet submitted
+
+        void* _sqRing      = None;
+        void* _cqRing      = None;
+        size_t _sqRingSize = 0;
+        size_t _cqRingSize = 0;
+        void* _sqes        = None;
+        size_t _sqesSize   = 0;
+
+        u32* _sqHead  = None;
+        u32* _sqTail  = None;
+        u32* _sqMask  = None;
+        u32* _sqArray = None;
+        u32* _cqHead  = None;
+        u32* _cqTail  = None;
+        u32* _cqMask  = None;
+        void* _cqes   = None;
+
+        bool Prepare(u8 opcode, i32 fd, u64 address, u32 size, u64 offset, u64 userData);
+        bool PopCompletion(Completion& completion);
+        void Destroy();
+    };
+}  // namespace x
@@ -0,0 +1,138 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "LineScanner.hpp"
+
+#include <bit>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define X_FIND_AVX2
+    #define X_FIND_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define X_FIND_SSE2
+#endif
+
+namespace x::Filesystem {
+    namespace {
+        // Below this, splitting the scan across workers costs more than it saves
+        constexpr size_t kMinParallelBytes = 4 * 1024 * 1024;
+
+        // Appends the start of every line in [begin, end) to `starts`. `begin` must itself be
+        // a line start; a newline that ends the range belongs to the next range's first line.
+        void ScanLineStarts(std::string_view text, size_t begin, size_t end, vector<u64>& starts) {
+            const char* base = text.data();
+            const char* stop = base + end;
+            const char* line = base + begin;
+            while (line < stop) {
+                starts.push_back(CAST<u64>(line - base));
+                const char* newline = FindByte(line, stop, '\n');
+                if (newline == stop) { break; }
+                line = newline + 1;
+            }
+        }
+    }  // namespace
+
+    const char* FindByte(const char* begin, const char* end, char byte) {
+        const char* cursor = begin;
+#ifdef X_FIND_AVX2
+        const __m256i wide = _mm256_set1_epi8(byte);
+        for (; end - cursor >= 32; cursor += 32) {
+            const __m256i chunk = _mm256_loadu_si256(RCAST<const __m256i*>(cursor));
+            const auto mask     = CAST<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, wide)));
+            if (mask != 0) { return cursor + std::countr_zero(mask); }
+        }
+#endif
+#ifdef X_FIND_SSE2
+        const __m128i narrow = _mm_set1_epi8(byte);
+        for (; end - cursor >= 16; cursor += 16) {
+            const __m128i chunk = _mm_loadu_si128(RCAST<const __m128i*>(cursor));
+            const auto mask     = CAST<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, narrow)));
+            if (mask != 0) { return cursor + std::countr_zero(mask); }
+        }
+#endif
+        for (; cursor < end; ++cursor) {
+            if (*cursor == byte) { return cursor; }
+        }
+        return end;
+    }
+
+    bool LineScanner::Next(std::string_view& line) {
+        if (_cursor >= _end) { return false; }
+        const char* newline = FindByte(_cursor, _end, '\n');
+        const char* lineEnd = newline;
+        if (lineEnd > _cursor && lineEnd[-1] == '\r') { --lineEnd; }
+        line    = {_cursor, CAST<size_t>(lineEnd - _cursor)};
+        _cursor = newline == _end ? _end : newline + 1;
+        return true;
+    }
+
+    LineIndex::LineIndex(std::string_view text, ThreadPool* pool) : _text(text) {
+        if (text.empty()) { return; }
+
+        const u32 chunkCount =
+          pool && text.size() >= kMinParallelBytes ? pool->GetThreadCount() : 1;
+        if (chunkCount <= 1) {
+            ScanLineStarts(text, 0, text.size(), _starts);
+            _starts.push_back(text.size());
+            return;
+        }
+
+        // Cut points are moved forward to just past a newline so every chunk starts a line
+        vector<size_t> bounds {0};
+        for (u32 i = 1; i < chunkCount; ++i) {
+            const size_t target = std::max(text.size() / chunkCount * i, bounds.back());
+            const char* newline = FindByte(text.data() + target, text.data() + text.size(), '\n');
+            const auto bound    = CAST<size_t>(newline - text.data()) + 1;
+            if (bound >= text.size()) { break; }
+            bounds.push_back(bound);
+        }
+        bounds.push_back(text.size());
+
+        vector<vector<u64>> partial(bounds.size() - 1);
+        vector<std::future<void>> scans;
+        for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+            scans.push_back(pool->Submit([&, i]() {
+                ScanLineStarts(text, bounds[i], bounds[i + 1], partial[i]);
+            }));
+        }
+        for (auto& scan : scans) {
+            scan.get();
+        }
+
+        size_t total = 1;
+        for (const auto& starts : partial) {
+            total += starts.size();
+        }
+        _starts.reserve(total);
+        for (const auto& starts : partial) {
+            _starts.insert(_starts.end(), starts.begin(), starts.end());
+        }
+        _starts.push_back(text.size());
+    }
+
+    std::string_view LineIndex::operator[](size_t line) const {
+        const auto begin = CAST<size_t>(_starts[line]);
+        auto end         = CAST<size_t>(_starts[line + 1]);
+        if (end > begin && _text[end - 1] == '\n') { --end; }
+        if (end > begin && _text[end - 1] == '\r') { --end; }
+        return _text.substr(begin, end - begin);
+    }
+
+    LineFile::LineFile(const Path& path, ThreadPool* pool) {
+        std::span<const u8> bytes;
+        if (auto packed = FindMounted(path)) {
+            _packed = std::move(packed);
+            bytes   = _packed->data;
+        } else {
+            _file = MappedFile(path);
+            if (!_file.IsOpen()) { return; }
+            bytes = _file.Data();
+        }
+        _text  = {RCAST<const char*>(bytes.data()), bytes.size()};
+        _index = LineIndex(_text, pool);
+        _open  = true;
+    }
+}  // namespace x::Filesystem
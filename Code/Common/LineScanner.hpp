@@ -0,0 +1,93 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include "PackArchive.hpp"
+#include "ThreadPool.hpp"
+#include <string_view>
+
+namespace x::Filesystem {
+    // First occurrence of `byte` in [begin, end), or `end`. Vectorized with SSE2/AVX2 where
+    // the target has them.
+    const char* FindByte(const char* begin, const char* end, char byte);
+
+    // Allocation-free line splitter over an in-memory region. Lines are split on '\n' with
+    // one trailing '\r' stripped, and a final newline does not produce an empty last line,
+    // so the result matches FileReader::ReadAllLines on LF and CRLF files alike.
+    class LineScanner {
+    public:
+        explicit LineScanner(std::string_view text)
+            : _cursor(text.data()), _end(text.data() + text.size()) {}
+
+        bool Next(std::string_view& line);
+
+        template<typename Func>
+        void ForEach(Func&& func) {
+            std::string_view line;
+            while (Next(line)) {
+                func(line);
+            }
+        }
+
+    private:
+        const char* _cursor;
+        const char* _end;
+    };
+
+    // Offsets of every line start in a region, built in one pass (in parallel with a pool,
+    // by splitting the region at newline boundaries). Holds 8 bytes per line and views into
+    // `text`, which must outlive the index.
+    class LineIndex {
+    public:
+        LineIndex() = default;
+        explicit LineIndex(std::string_view text, ThreadPool* pool = None);
+
+        size_t Size() const {
+            return _starts.empty() ? 0 : _starts.size() - 1;
+        }
+
+        std::string_view operator[](size_t line) const;
+
+    private:
+        std::string_view _text;
+        // One past the last line is a sentinel, so line i spans [starts[i], starts[i + 1])
+        vector<u64> _starts;
+    };
+
+    // Maps a text file (loose or from a mounted archive) and indexes its lines. Views stay
+    // valid for the lifetime of the object.
+    class LineFile {
+    public:
+        explicit LineFile(const Path& path, ThreadPool* pool = None);
+
+        LineFile(const LineFile&)            = delete;
+        LineFile& operator=(const LineFile&) = delete;
+
+        bool IsOpen() const {
+            return _open;
+        }
+
+        std::string_view GetText() const {
+            return _text;
+        }
+
+        size_t GetLineCount() const {
+            return _index.Size();
+        }
+
+        std::string_view GetLine(size_t line) const {
+            return _index[line];
+        }
+
+    private:
+        MappedFile _file;
+        std::optional<MountedFile> _packed;
+        std::string_view _text;
+        LineIndex _index;
+        bool _open = false;
+    };
+}  // namespace x::Filesystem
@@ -0,0 +1,171 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Lz4.hpp"
+
+namespace x::Lz4 {
+    namespace {
+        constexpr size_t kMinMatch     = 4;
+        constexpr size_t kLastLiterals = 5;   // The block always ends with this many literals
+        constexpr size_t kMatchLimit   = 12;  // No match may start within this many of the end
+        constexpr size_t kMaxDistance  = 65535;
+        constexpr u32 kHashLog         = 12;
+
+        u32 Read32(const u8* p) {
+            u32 value;
+            memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        u32 HashSequence(u32 sequence) {
+            return (sequence * 2654435761u) >> (32 - kHashLog);
+        }
+
+        u8* WriteLength(u8* op, size_t length) {
+            while (length >= 255) {
+                *op++ = 255;
+                length -= 255;
+            }
+            *op++ = CAST<u8>(length);
+            return op;
+        }
+
+        bool ReadLength(const u8*& ip, const u8* end, size_t& length) {
+            u8 byte;
+            do {
+                if (ip >= end) { return false; }
+                byte = *ip++;
+                length += byte;
+            } while (byte == 255);
+            return true;
+        }
+
+        u8* WriteSequence(u8* op, const u8* literals, size_t literalLength) {
+            if (literalLength >= 15) {
+                *op++ = 15 << 4;
+                op    = WriteLength(op, literalLength - 15);
+            } else {
+                *op++ = CAST<u8>(literalLength << 4);
+            }
+            if (literalLength > 0) { memcpy(op, literals, literalLength); }
+            return op + literalLength;
+        }
+    }  // namespace
+
+    size_t Compress(const u8* src, size_t size, u8* dst, size_t capacity) {
+        if (capacity < CompressBound(size)) { return 0; }
+
+        const u8* ip     = src;
+        const u8* anchor = src;
+        const u8* end    = src + size;
+        u8* op           = dst;
+
+        if (size > kMatchLimit) {
+            const u8* matchEnd   = end - kLastLiterals;
+            const u8* matchStart = end - kMatchLimit;
+            u32 table[1u << kHashLog] {};
+
+            while (ip < matchStart) {
+                const u32 hash  = HashSequence(Read32(ip));
+                const u8* match = src + table[hash];
+                table[hash]     = CAST<u32>(ip - src);
+
+                if (match >= ip || CAST<size_t>(ip - match) > kMaxDistance ||
+                    Read32(match) != Read32(ip)) {
+                    // Step further the longer we go without a match; incompressible data
+                    // is skipped quickly
+                    ip += 1 + ((ip - anchor) >> 6);
+                    continue;
+                }
+
+                while (ip > anchor && match > src && ip[-1] == match[-1]) {
+                    --ip;
+                    --match;
+                }
+                const u8* matchCursor = match + kMinMatch;
+                const u8* cursor      = ip + kMinMatch;
+                while (cursor < matchEnd && *cursor == *matchCursor) {
+                    ++cursor;
+                    ++matchCursor;
+                }
+
+                u8* token                = op;
+                op                       = WriteSequence(op, anchor, CAST<size_t>(ip - anchor));
+                const auto offset        = CAST<u16>(ip - match);
+                *op++                    = CAST<u8>(offset);
+                *op++                    = CAST<u8>(offset >> 8);
+                const size_t matchLength = CAST<size_t>(cursor - ip) - kMinMatch;
+                if (matchLength >= 15) {
+                    *token |= 15;
+                    op = WriteLength(op, matchLength - 15);
+                } else {
+                    *token |= CAST<u8>(matchLength);
+                }
+
+                ip     = cursor;
+                anchor = ip;
+                // Seed the table from inside the match so the next search has a candidate
+                if (ip < matchStart) {
+                    table[HashSequence(Read32(ip - 2))] = CAST<u32>(ip - 2 - src);
+                }
+            }
+        }
+
+        op = WriteSequence(op, anchor, CAST<size_t>(end - anchor));
+        return CAST<size_t>(op - dst);
+    }
+
+    bool Decompress(const u8* src, size_t srcSize, u8* dst, size_t dstSize) {
+        const u8* ip     = src;
+        const u8* end    = src + srcSize;
+        u8* op           = dst;
+        u8* const outEnd = dst + dstSize;
+
+        while (ip < end) {
+            const u8 token       = *ip++;
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !ReadLength(ip, end, literalLength)) { return false; }
+            if (literalLength > CAST<size_t>(end - ip) ||
+                literalLength > CAST<size_t>(outEnd - op)) {
+                return false;
+            }
+            if (literalLength <= 16 && end - ip >= 16 && outEnd - op >= 16) {
+                // Short run with room to spare: one fixed-size copy beats a sized memcpy
+                memcpy(op, ip, 16);
+            } else if (literalLength > 0) {
+                memcpy(op, ip, literalLength);
+            }
+            op += literalLength;
+            ip += literalLength;
+            if (ip == end) { break; }  // The last sequence has no match
+
+            if (end - ip < 2) { return false; }
+            const size_t offset = ip[0] | (CAST<size_t>(ip[1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > CAST<size_t>(op - dst)) { return false; }
+
+            size_t matchLength = token & 15;
+            if (matchLength == 15 && !ReadLength(ip, end, matchLength)) { return false; }
+            matchLength += kMinMatch;
+            if (matchLength > CAST<size_t>(outEnd - op)) { return false; }
+
+            const u8* match = op - offset;
+            if (offset >= 8 && CAST<size_t>(outEnd - op) >= matchLength + 8) {
+                // 8-byte steps may overrun the match by up to 7 bytes, which the next
+                // sequence overwrites; an offset of at least 8 keeps each step's source
+                // fully written
+                for (size_t i = 0; i < matchLength; i += 8) {
+                    memcpy(op + i, match + i, 8);
+                }
+            } else {
+                // Overlapping copy repeats the last `offset` bytes
+                for (size_t i = 0; i < matchLength; ++i) {
+                    op[i] = match[i];
+                }
+            }
+            op += matchLength;
+        }
+        return op == outEnd;
+    }
+}  // namespace x::Lz4
@@ -0,0 +1,23 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+namespace x::Lz4 {
+    // LZ4 block format (no frame header or checksums): a greedy single-pass compressor with a
+    // 4K-entry hash table and a bounds-checked decompressor that rejects malformed input.
+
+    // Worst-case compressed size for `size` input bytes.
+    constexpr size_t CompressBound(size_t size) {
+        return size + size / 255 + 16;
+    }
+
+    // Returns the compressed size, or 0 if `capacity` is smaller than CompressBound(size).
+    size_t Compress(const u8* src, size_t size, u8* dst, size_t capacity);
+
+    // Decodes exactly `dstSize` bytes. Returns false on malformed or truncated input.
+    bool Decompress(const u8* src, size_t srcSize, u8* dst, size_t dstSize);
+}  // namespace x::Lz4
@@ -0,0 +1,295 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "MemoryTracker.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace x {
+    namespace {
+        // One cache line per tag, so threads working on different subsystems don't contend
+        struct alignas(64) TagCounters {
+            std::atomic<u64> liveBytes;
+            std::atomic<u64> peakBytes;
+            std::atomic<u64> liveAllocations;
+            std::atomic<u64> totalAllocations;
+            std::atomic<u64> frameAllocations;
+            std::atomic<u64> frameBytes;
+            std::atomic<u64> lastFrameAllocations;
+            std::atomic<u64> lastFrameBytes;
+            std::atomic<u64> budget;
+        };
+
+        // Constant-initialized, so operator new can use them before main()
+        array<TagCounters, kMemoryTagCount> gCounters;
+        std::atomic<u64> gFrame;
+
+        TagCounters& CountersFor(MemoryTag tag) {
+            return gCounters[CAST<size_t>(tag)];
+        }
+
+        void* AlignedAlloc(size_t bytes, size_t alignment) {
+            bytes = std::max<size_t>(bytes, 1);
+            if (alignment <= alignof(std::max_align_t)) { return std::malloc(bytes); }
+#ifdef _WIN32
+            return _aligned_malloc(bytes, alignment);
+#else
+            // aligned_alloc wants a multiple of the alignment
+            return std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1));
+#endif
+        }
+
+        void AlignedFree(void* memory, [[maybe_unused]] size_t alignment) {
+#ifdef _WIN32
+            if (alignment > alignof(std::max_align_t)) {
+                _aligned_free(memory);
+                return;
+            }
+#endif
+            std::free(memory);
+        }
+    }  // namespace
+
+    const char* GetMemoryTagName(MemoryTag tag) {
+        switch (tag) {
+            case MemoryTag::General:
+                return "General";
+            case MemoryTag::Components:
+                return "Components";
+            case MemoryTag::Scene:
+                return "Scene";
+            case MemoryTag::FileBuffers:
+                return "FileBuffers";
+            case MemoryTag::Assets:
+                return "Assets";
+            case MemoryTag::Transient:
+                return "Transient";
+            case MemoryTag::Graphics:
+                return "Graphics";
+            default:
+                return "Unknown";
+        }
+    }
+
+    str MemorySnapshot::ToString() const {
+        str out;
+        char row[192];
+        snprintf(row,
+                 sizeof(row),
+                 "%-12s %14s %14s %10s %12s %8s %12s %14s\n",
+                 "Tag",
+                 "Live",
+                 "Peak",
+                 "Allocs",
+                 "Total",
+                 "Frame",
+                 "FrameBytes",
+                 "Budget");
+        out += row;
+        for (size_t index = 0; index < kMemoryTagCount; ++index) {
+            const MemoryTagStats& stats = tags[index];
+            snprintf(row,
+                     sizeof(row),
+                     "%-12s %14llu %14llu %10llu %12llu %8llu %12llu %14llu%s\n",
+                     GetMemoryTagName(CAST<MemoryTag>(index)),
+                     CAST<unsigned long long>(stats.liveBytes),
+                     CAST<unsigned long long>(stats.peakBytes),
+                     CAST<unsigned long long>(stats.liveAllocations),
+                     CAST<unsigned long long>(stats.totalAllocations),
+                     CAST<unsigned long long>(stats.frameAllocations),
+                     CAST<unsigned long long>(stats.frameBytes),
+                     CAST<unsigned long long>(stats.budget),
+                     stats.budget > 0 && stats.liveBytes > stats.budget ? "  OVER BUDGET" : "");
+            out += row;
+        }
+        return out;
+    }
+
+    void MemoryTracker::Track(MemoryTag tag, size_t bytes) {
+        TagCounters& counters = CountersFor(tag);
+        const u64 live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        u64 peak       = counters.peakBytes.load(std::memory_order_relaxed);
+        while (live > peak &&
+               !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+        counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.frameBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::Untrack(MemoryTag tag, size_t bytes) {
+        TagCounters& counters = CountersFor(tag);
+        counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void* MemoryTracker::Allocate(MemoryTag tag, size_t bytes, size_t alignment) {
+        void* memory = AlignedAlloc(bytes, alignment);
+        if (!memory) { throw std::bad_alloc(); }
+        Track(tag, bytes);
+        return memory;
+    }
+
+    void MemoryTracker::Free(MemoryTag tag, void* memory, size_t bytes, size_t alignment) {
+        if (!memory) { return; }
+        Untrack(tag, bytes);
+        AlignedFree(memory, alignment);
+    }
+
+    void MemoryTracker::BeginFrame() {
+        for (TagCounters& counters : gCounters) {
+            const u64 count = counters.frameAllocations.exchange(0, std::memory_order_relaxed);
+            const u64 bytes = counters.frameBytes.exchange(0, std::memory_order_relaxed);
+            counters.lastFrameAllocations.store(count, std::memory_order_relaxed);
+            counters.lastFrameBytes.store(bytes, std::memory_order_relaxed);
+        }
+        gFrame.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    MemorySnapshot MemoryTracker::GetSnapshot() {
+        MemorySnapshot snapshot;
+        snapshot.frame = gFrame.load(std::memory_order_relaxed);
+        for (size_t index = 0; index < kMemoryTagCount; ++index) {
+            const TagCounters& counters = gCounters[index];
+            const auto load = [](const std::atomic<u64>& value) {
+                return value.load(std::memory_order_relaxed);
+            };
+
+            MemoryTagStats& stats  = snapshot.tags[index];
+            stats.liveBytes        = load(counters.liveBytes);
+            stats.peakBytes        = load(counters.peakBytes);
+            stats.liveAllocations  = load(counters.liveAllocations);
+            stats.totalAllocations = load(counters.totalAllocations);
+            stats.frameAllocations = load(counters.lastFrameAllocations);
+            stats.frameBytes       = load(counters.lastFrameBytes);
+            stats.budget           = load(counters.budget);
+        }
+        return snapshot;
+    }
+
+    void MemoryTracker::SetBudget(MemoryTag tag, u64 bytes) {
+        CountersFor(tag).budget.store(bytes, std::memory_order_relaxed);
+    }
+
+    bool MemoryTracker::IsOverBudget(MemoryTag tag) {
+        const TagCounters& counters = CountersFor(tag);
+        const u64 budget            = counters.budget.load(std::memory_order_relaxed);
+        return budget > 0 && counters.liveBytes.load(std::memory_order_relaxed) > budget;
+    }
+
+    MemoryTag MemoryTracker::GetCurrentTag() {
+        return sCurrentTag;
+    }
+
+#ifdef X_TRACK_GLOBAL_ALLOCATIONS
+    namespace {
+        // Sits just before every pointer operator new returns
+        struct AllocationHeader {
+            u64 size;
+            u32 alignment;
+            MemoryTag tag;
+        };
+        static_assert(sizeof(AllocationHeader) <= alignof(std::max_align_t));
+
+        size_t HeaderOffset(size_t alignment) {
+            return std::max(alignment, alignof(std::max_align_t));
+        }
+
+        void* TrackedNew(size_t size, size_t alignment) noexcept {
+            alignment           = std::max(alignment, alignof(std::max_align_t));
+            const size_t offset = HeaderOffset(alignment);
+            auto* base          = CAST<u8*>(AlignedAlloc(offset + size, alignment));
+            if (!base) { return None; }
+
+            const MemoryTag tag = MemoryTracker::GetCurrentTag();
+            auto* header        = RCAST<AllocationHeader*>(base + offset) - 1;
+            header->size        = size;
+            header->alignment   = CAST<u32>(alignment);
+            header->tag         = tag;
+            MemoryTracker::Track(tag, size);
+            return base + offset;
+        }
+
+        void TrackedDelete(void* memory) noexcept {
+            if (!memory) { return; }
+            const auto* header = CAST<const AllocationHeader*>(memory) - 1;
+            MemoryTracker::Untrack(header->tag, header->size);
+            AlignedFree(CAST<u8*>(memory) - HeaderOffset(header->alignment), header->alignment);
+        }
+
+        void* TrackedNewOrThrow(size_t size, size_t alignment) {
+            void* memory = TrackedNew(size, alignment);
+            if (!memory) { throw std::bad_alloc(); }
+            return memory;
+        }
+    }  // namespace
+#endif
+}  // namespace x
+
+#ifdef X_TRACK_GLOBAL_ALLOCATIONS
+void* operator new(size_t size) {
+    return x::TrackedNewOrThrow(size, alignof(std::max_align_t));
+}
+void* operator new[](size_t size) {
+    return x::TrackedNewOrThrow(size, alignof(std::max_align_t));
+}
+void* operator new(size_t size, std::align_val_t alignment) {
+    return x::TrackedNewOrThrow(size, CAST<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return x::TrackedNewOrThrow(size, CAST<size_t>(alignment));
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return x::TrackedNew(size, alignof(std::max_align_t));
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return x::TrackedNew(size, alignof(std::max_align_t));
+}
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return x::TrackedNew(size, CAST<size_t>(alignment));
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return x::TrackedNew(size, CAST<size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete[](void* memory) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete(void* memory, size_t) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete[](void* memory, size_t) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete(void* memory, std::align_val_t) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    x::TrackedDelete(memory);
+}
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    x::TrackedDelete(memory);
+}
+#endif
+
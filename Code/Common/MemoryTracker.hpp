@@ -0,0 +1,147 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <new>
+
+namespace x {
+    enum class MemoryTag : u8 {
+        General,  // Anything allocated outside a MemoryScope
+        Components,
+        Scene,
+        FileBuffers,
+        Assets,
+        Transient,  // Frame and scratch arenas
+        Graphics,  // GPU memory behind buffers; tracked, not allocated, here
+        Count,
+    };
+
+    constexpr size_t kMemoryTagCount = CAST<size_t>(MemoryTag::Count);
+
+    const char* GetMemoryTagName(MemoryTag tag);
+
+    struct MemoryTagStats {
+        u64 liveBytes        = 0;
+        u64 peakBytes        = 0;
+        u64 liveAllocations  = 0;
+        u64 totalAllocations = 0;
+        u64 frameAllocations = 0;  // During the last completed frame
+        u64 frameBytes       = 0;
+        u64 budget           = 0;  // Zero when unlimited
+    };
+
+    struct MemorySnapshot {
+        u64 frame = 0;  // Frames completed when the snapshot was taken
+        array<MemoryTagStats, kMemoryTagCount> tags;
+
+        const MemoryTagStats& operator[](MemoryTag tag) const {
+            return tags[CAST<size_t>(tag)];
+        }
+
+        // One row per tag, e.g. for a log or a debug overlay.
+        str ToString() const;
+    };
+
+    // Process-wide allocation accounting per MemoryTag. Tagged allocators report here always;
+    // with X_TRACK_GLOBAL_ALLOCATIONS defined, every operator new in the process does too,
+    // attributed to the innermost MemoryScope on the calling thread. Thread-safe.
+    class MemoryTracker {
+    public:
+        // Accounting only, for memory allocated elsewhere (GPU buffers, mapped files).
+        static void Track(MemoryTag tag, size_t bytes);
+        static void Untrack(MemoryTag tag, size_t bytes);
+
+        // Tracked heap memory, bypassing operator new so it is never counted twice.
+        static void* Allocate(MemoryTag tag, size_t bytes, size_t alignment);
+        static void Free(MemoryTag tag, void* memory, size_t bytes, size_t alignment);
+
+        // Closes a frame: the allocations counted since the previous call become the
+        // snapshot's frame figures.
+        static void BeginFrame();
+
+        static MemorySnapshot GetSnapshot();
+
+        // Budgets are only reported, never enforced by failing allocations.
+        static void SetBudget(MemoryTag tag, u64 bytes);
+        static bool IsOverBudget(MemoryTag tag);
+
+        static MemoryTag GetCurrentTag();
+
+    private:
+        friend class MemoryScope;
+
+        static inline thread_local MemoryTag sCurrentTag = MemoryTag::General;
+    };
+
+    // Attributes untagged allocations on this thread to `tag` while in scope. Only matters
+    // when global allocation tracking is compiled in.
+    class MemoryScope {
+    public:
+        explicit MemoryScope(MemoryTag tag) : _previous(MemoryTracker::sCurrentTag) {
+            MemoryTracker::sCurrentTag = tag;
+        }
+
+        ~MemoryScope() {
+            MemoryTracker::sCurrentTag = _previous;
+        }
+
+        MemoryScope(const MemoryScope&)            = delete;
+        MemoryScope& operator=(const MemoryScope&) = delete;
+
+    private:
+        MemoryTag _previous;
+    };
+
+    // Stateless STL allocator charging every allocation to `Tag`.
+    template<typename T, MemoryTag Tag>
+    class TaggedAllocator {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind {
+            using other = TaggedAllocator<U, Tag>;
+        };
+
+        TaggedAllocator() = default;
+
+        template<typename U>
+        TaggedAllocator(const TaggedAllocator<U, Tag>&) {}
+
+        T* allocate(size_t count) {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            return CAST<T*>(MemoryTracker::Allocate(Tag, count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* memory, size_t count) {
+            MemoryTracker::Free(Tag, memory, count * sizeof(T), alignof(T));
+        }
+
+        template<typename U>
+        bool operator==(const TaggedAllocator<U, Tag>&) const {
+            return true;
+        }
+    };
+
+    template<typename T, MemoryTag Tag>
+    using TaggedVector = std::vector<T, TaggedAllocator<T, Tag>>;
+
+    template<typename K, typename V, MemoryTag Tag, typename Hash = std::hash<K>>
+    using TaggedUnorderedMap =
+      std::unordered_map<K, V, Hash, std::equal_to<K>, TaggedAllocator<std::pair<const K, V>, Tag>>;
+
+    // make_shared with the object and its control block charged to `Tag`.
+    template<typename T, MemoryTag Tag, typename... Args>
+    shared_ptr<T> MakeTaggedShared(Args&&... args) {
+        return std::allocate_shared<T>(TaggedAllocator<T, Tag>(), std::forward<Args>(args)...);
+    }
+}  // namespace x
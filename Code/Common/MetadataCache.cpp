@@ -0,0 +1,460 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "MetadataCache.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <cerrno>
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#ifdef __linux__
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/inotify.h>
+    #include <sys/syscall.h>
+#endif
+
+namespace x::Filesystem {
+    namespace {
+        str JoinChild(std::string_view directory, std::string_view name) {
+            str path;
+            path.reserve(directory.size() + name.size() + 1);
+            path += directory;
+            if (path.empty() || path.back() != PATH_SEPARATOR) { path += PATH_SEPARATOR; }
+            path += name;
+            return path;
+        }
+
+        // Splits a normalized path into its parent directory and final component.
+        std::optional<std::pair<std::string_view, std::string_view>>
+        SplitPath(std::string_view path) {
+            const size_t separator = path.find_last_of(PATH_SEPARATOR);
+            if (separator == std::string_view::npos || separator + 1 == path.size()) {
+                return Empty;
+            }
+            const auto directory = path.substr(0, separator == 0 ? 1 : separator);
+            return std::pair {directory, path.substr(separator + 1)};
+        }
+
+        bool IsDotEntry(std::string_view name) {
+            return name == "." || name == "..";
+        }
+
+#ifndef _WIN32
+        FileMetadata FromStat(const struct stat& info) {
+            if (S_ISREG(info.st_mode)) { return {EntryType::File, u64(info.st_size)}; }
+            if (S_ISDIR(info.st_mode)) { return {EntryType::Directory}; }
+            return {EntryType::Other};
+        }
+
+        void AppendEntry(i32 directoryFd,
+                         const char* name,
+                         u8 type,
+                         bool querySizes,
+                         vector<DirectoryEntry>& entries) {
+            FileMetadata metadata;
+            switch (type) {
+                case DT_REG:
+                    metadata.type = EntryType::File;
+                    break;
+                case DT_DIR:
+                    metadata.type = EntryType::Directory;
+                    break;
+                case DT_LNK:
+                case DT_UNKNOWN:
+                    break;
+                default:
+                    metadata.type = EntryType::Other;
+                    break;
+            }
+
+            // Symlinks resolve to their target like stat() would; the rest only need a stat
+            // for the size
+            const bool resolve = metadata.type == EntryType::None;
+            if (resolve || (querySizes && metadata.type == EntryType::File)) {
+                struct stat info {};
+                if (fstatat(directoryFd, name, &info, 0) != 0) { return; }  // Dangling or gone
+                metadata = FromStat(info);
+            }
+            entries.push_back({str(name), metadata});
+        }
+#endif
+    }  // namespace
+
+#pragma region Scanning
+    bool ListDirectory(const Path& directory, vector<DirectoryEntry>& entries, bool querySizes) {
+        entries.clear();
+#ifdef _WIN32
+        // Basic info skips the 8.3 name; sizes come with every entry for free
+        std::ignore = querySizes;
+        WIN32_FIND_DATAA data;
+        const str pattern = JoinChild(directory.Str(), "*");
+        const HANDLE find = FindFirstFileExA(pattern.c_str(),
+                                             FindExInfoBasic,
+                                             &data,
+                                             FindExSearchNameMatch,
+                                             None,
+                                             FIND_FIRST_EX_LARGE_FETCH);
+        if (find == INVALID_HANDLE_VALUE) { return false; }
+        do {
+            if (IsDotEntry(data.cFileName)) { continue; }
+            FileMetadata metadata {EntryType::Directory};
+            if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+                metadata = {EntryType::File, u64(data.nFileSizeHigh) << 32 | data.nFileSizeLow};
+            }
+            entries.push_back({data.cFileName, metadata});
+        } while (FindNextFileA(find, &data));
+        const bool ok = GetLastError() == ERROR_NO_MORE_FILES;
+        FindClose(find);
+        return ok;
+#elif defined(__linux__)
+        const i32 fd = open(directory.CStr(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0) { return false; }
+
+        // One getdents64 call returns hundreds of entries, d_type included
+        vector<u8> buffer(64 * 1024);
+        bool ok = true;
+        for (;;) {
+            const long size = syscall(SYS_getdents64, fd, buffer.data(), buffer.size());
+            if (size <= 0) {
+                ok = size == 0;
+                break;
+            }
+            for (long offset = 0; offset < size;) {
+                const auto* entry = RCAST<const dirent64*>(buffer.data() + offset);
+                offset += entry->d_reclen;
+                if (IsDotEntry(entry->d_name)) { continue; }
+                AppendEntry(fd, entry->d_name, entry->d_type, querySizes, entries);
+            }
+        }
+        close(fd);
+        return ok;
+#else
+        DIR* handle = opendir(directory.CStr());
+        if (!handle) { return false; }
+        errno = 0;
+        while (const dirent* entry = readdir(handle)) {
+            if (!IsDotEntry(entry->d_name)) {
+                AppendEntry(dirfd(handle), entry->d_name, entry->d_type, querySizes, entries);
+            }
+            errno = 0;
+        }
+        const bool ok = errno == 0;
+        closedir(handle);
+        return ok;
+#endif
+    }
+
+    vector<ScannedEntry> ScanDirectory(const Path& root, const ScanOptions& options) {
+        auto& cache = MetadataCache::Global();
+        // Watch before listing so a change that lands mid-listing bumps the generation and
+        // the listing is discarded rather than cached
+        const auto list = [&](const str& directory, vector<DirectoryEntry>& entries) {
+            const auto generation = cache.Watch(directory);
+            if (!ListDirectory(Path(directory), entries, options.querySizes)) {
+                entries.clear();
+                return;
+            }
+            if (generation) { cache.Store(directory, *generation, entries); }
+        };
+
+        vector<ScannedEntry> result;
+        vector<str> level {root.Str()};
+        while (!level.empty()) {
+            vector<vector<DirectoryEntry>> listings(level.size());
+            const size_t tasks =
+              options.pool ? std::min<size_t>(level.size(), 4 * options.pool->GetThreadCount()) : 1;
+            if (tasks <= 1) {
+                for (size_t i = 0; i < level.size(); ++i) {
+                    list(level[i], listings[i]);
+                }
+            } else {
+                // Strided so every task gets a mix of large and small directories
+                vector<std::future<void>> pending;
+                pending.reserve(tasks);
+                for (size_t task = 0; task < tasks; ++task) {
+                    pending.push_back(options.pool->Submit([&, task]() {
+                        for (size_t i = task; i < level.size(); i += tasks) {
+                            list(level[i], listings[i]);
+                        }
+                    }));
+                }
+                for (auto& future : pending) {
+                    future.get();
+                }
+            }
+
+            vector<str> next;
+            for (size_t i = 0; i < level.size(); ++i) {
+                for (auto& entry : listings[i]) {
+                    str path = JoinChild(level[i], entry.name);
+                    if (options.recursive && entry.metadata.type == EntryType::Directory) {
+                        next.push_back(path);
+                    }
+                    result.push_back({std::move(path), entry.metadata});
+                }
+            }
+            level = std::move(next);
+        }
+        return result;
+    }
+#pragma endregion
+
+#pragma region MetadataCache
+    void MetadataCache::CachedDirectory::Reset() {
+        ++generation;
+        complete = false;
+        entries.clear();
+    }
+
+    MetadataCache::~MetadataCache() {
+        Disable();
+    }
+
+    MetadataCache& MetadataCache::Global() {
+        static MetadataCache cache;
+        return cache;
+    }
+
+    bool MetadataCache::Enable() {
+        std::lock_guard state(_stateMutex);
+        if (_enabled.load(std::memory_order_relaxed)) { return true; }
+#ifdef __linux__
+        const i32 inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd < 0) { return false; }
+        const i32 wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (wakeFd < 0) {
+            close(inotifyFd);
+            return false;
+        }
+        {
+            std::lock_guard lock(_watchMutex);
+            _inotifyFd = inotifyFd;
+            _wakeFd    = wakeFd;
+        }
+        {
+            std::unique_lock lock(_mutex);
+            _directories.clear();
+        }
+        _enabled.store(true, std::memory_order_release);
+        _watcher = std::thread(&MetadataCache::WatchLoop, this);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void MetadataCache::Disable() {
+        std::lock_guard state(_stateMutex);
+        if (!_enabled.exchange(false)) { return; }
+#ifdef __linux__
+        const u64 wake = 1;
+        std::ignore    = write(_wakeFd, &wake, sizeof(wake));
+        _watcher.join();
+        {
+            std::lock_guard lock(_watchMutex);
+            close(_inotifyFd);
+            close(_wakeFd);
+            _inotifyFd = -1;
+            _wakeFd    = -1;
+            _watches.clear();
+        }
+#endif
+        std::unique_lock lock(_mutex);
+        _directories.clear();
+    }
+
+    bool MetadataCache::IsEnabled() const {
+        return _enabled.load(std::memory_order_acquire);
+    }
+
+    std::optional<FileMetadata> MetadataCache::Lookup(std::string_view path) const {
+        if (!IsEnabled()) { return Empty; }
+        const auto split = SplitPath(path);
+
+        std::shared_lock lock(_mutex);
+        // A directory that is listed (and still watched) certainly exists
+        const auto self = _directories.find(path);
+        if (self != _directories.end() && self->second.complete) {
+            return FileMetadata {EntryType::Directory};
+        }
+        if (!split) { return Empty; }
+
+        const auto directory = _directories.find(split->first);
+        if (directory == _directories.end()) { return Empty; }
+        const auto& cached = directory->second;
+        const auto entry   = cached.entries.find(split->second);
+        if (entry != cached.entries.end()) { return entry->second; }
+        if (cached.complete) { return FileMetadata {}; }
+        return Empty;
+    }
+
+    void MetadataCache::Invalidate(std::string_view path) {
+        if (!IsEnabled()) { return; }
+        if (const auto split = SplitPath(path)) { InvalidateEntry(split->first, split->second); }
+
+        // `path` may itself be a listed directory that was just replaced
+        std::unique_lock lock(_mutex);
+        const auto self = _directories.find(path);
+        if (self != _directories.end()) { self->second.Reset(); }
+    }
+
+    void MetadataCache::Clear() {
+        std::unique_lock lock(_mutex);
+        for (auto& [path, directory] : _directories) {
+            directory.Reset();
+        }
+    }
+
+    size_t MetadataCache::GetDirectoryCount() const {
+        std::shared_lock lock(_mutex);
+        return CAST<size_t>(std::count_if(_directories.begin(),
+                                          _directories.end(),
+                                          [](const auto& entry) { return entry.second.complete; }));
+    }
+
+    size_t MetadataCache::GetEntryCount() const {
+        std::shared_lock lock(_mutex);
+        size_t count = 0;
+        for (const auto& [path, directory] : _directories) {
+            count += directory.entries.size();
+        }
+        return count;
+    }
+
+    std::optional<u64> MetadataCache::Watch(const str& directory) {
+        if (!IsEnabled()) { return Empty; }
+#ifdef __linux__
+        {
+            std::lock_guard lock(_watchMutex);
+            if (_inotifyFd < 0) { return Empty; }
+            constexpr u32 kMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM |
+                                  IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+            // Fails once fs.inotify.max_user_watches is exhausted; the directory just goes
+            // uncached
+            const i32 wd = inotify_add_watch(_inotifyFd, directory.c_str(), kMask);
+            if (wd < 0) { return Empty; }
+            _watches[wd] = directory;
+        }
+        std::unique_lock lock(_mutex);
+        return _directories.try_emplace(directory).first->second.generation;
+#else
+        std::ignore = directory;
+        return Empty;
+#endif
+    }
+
+    void MetadataCache::Store(const str& directory,
+                              u64 generation,
+                              const vector<DirectoryEntry>& entries) {
+        std::unique_lock lock(_mutex);
+        const auto it = _directories.find(directory);
+        if (it == _directories.end() || it->second.generation != generation) { return; }
+
+        auto& cached = it->second;
+        cached.entries.clear();
+        cached.entries.reserve(entries.size());
+        for (const auto& entry : entries) {
+            cached.entries.emplace(entry.name, entry.metadata);
+        }
+        cached.complete = true;
+    }
+
+    void MetadataCache::InvalidateEntry(std::string_view directory, std::string_view name) {
+        std::unique_lock lock(_mutex);
+        const auto it = _directories.find(directory);
+        if (it == _directories.end()) { return; }
+
+        auto& cached = it->second;
+        ++cached.generation;
+        cached.complete = false;
+        const auto entry = cached.entries.find(name);
+        if (entry != cached.entries.end()) { cached.entries.erase(entry); }
+    }
+
+    void MetadataCache::ResetTree(std::string_view directory) {
+        std::unique_lock lock(_mutex);
+        for (auto& [path, cached] : _directories) {
+            const std::string_view candidate = path;
+            if (candidate.substr(0, directory.size()) != directory) { continue; }
+            if (candidate.size() == directory.size() || directory.back() == PATH_SEPARATOR ||
+                candidate[directory.size()] == PATH_SEPARATOR) {
+                cached.Reset();
+            }
+        }
+    }
+
+#ifdef __linux__
+    void MetadataCache::WatchLoop() {
+        alignas(inotify_event) char buffer[16 * 1024];
+        pollfd fds[2] = {{_inotifyFd, POLLIN, 0}, {_wakeFd, POLLIN, 0}};
+        for (;;) {
+            if (poll(fds, 2, -1) < 0) {
+                if (errno == EINTR) { continue; }
+                break;
+            }
+            if (fds[1].revents != 0) { break; }
+
+            for (;;) {
+                const ssize_t size = read(_inotifyFd, buffer, sizeof(buffer));
+                if (size <= 0) { break; }  // Drained
+                for (ssize_t offset = 0; offset < size;) {
+                    const auto* event = RCAST<const inotify_event*>(buffer + offset);
+                    offset += CAST<ssize_t>(sizeof(inotify_event) + event->len);
+                    HandleEvent(event->wd,
+                                event->mask,
+                                event->len > 0 ? std::string_view(event->name)
+                                               : std::string_view());
+                }
+            }
+        }
+    }
+
+    void MetadataCache::HandleEvent(i32 wd, u32 mask, std::string_view name) {
+        if (mask & IN_Q_OVERFLOW) {
+            // Events were dropped, so nothing cached can be trusted
+            Clear();
+            return;
+        }
+
+        str directory;
+        {
+            std::lock_guard lock(_watchMutex);
+            const auto it = _watches.find(wd);
+            if (it == _watches.end()) { return; }
+            directory = it->second;
+            if (mask & IN_IGNORED) {
+                _watches.erase(it);
+                return;
+            }
+            if (mask & IN_MOVE_SELF) {
+                // The watch would follow the directory to its new name; stop listening
+                inotify_rm_watch(_inotifyFd, wd);
+                _watches.erase(it);
+            }
+        }
+
+        if (mask & (IN_DELETE_SELF | IN_MOVE_SELF)) {
+            ResetTree(directory);
+            return;
+        }
+        InvalidateEntry(directory, name);
+        // Everything cached below a directory that moved or was replaced is stale too
+        if ((mask & IN_ISDIR) && (mask & (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO))) {
+            ResetTree(JoinChild(directory, name));
+        }
+    }
+#endif
+#pragma endregion
+}  // namespace x::Filesystem
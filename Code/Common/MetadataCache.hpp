@@ -0,0 +1,141 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+namespace x::Filesystem {
+    enum class EntryType : u8 {
+        None,  // Doesn't exist
+        File,
+        Directory,
+        Other,  // Sockets, devices, FIFOs
+    };
+
+    struct FileMetadata {
+        static constexpr u64 kUnknownSize = ~0ull;
+
+        EntryType type = EntryType::None;
+        u64 size       = kUnknownSize;  // Regular files only
+    };
+
+    struct DirectoryEntry {
+        str name;
+        FileMetadata metadata;
+    };
+
+    struct ScannedEntry {
+        str path;  // Already normalized; Path(path) round-trips
+        FileMetadata metadata;
+    };
+
+    struct ScanOptions {
+        bool recursive = true;
+        // Sizes cost one fstatat per file relative to the open directory; types alone cost
+        // nothing beyond the directory read.
+        bool querySizes  = true;
+        ThreadPool* pool = None;
+    };
+
+    // Lists one directory in a single pass: getdents64 with a large buffer on Linux,
+    // FindFirstFileEx with large fetches on Windows. Types come from the directory entries
+    // themselves; only symlinks and filesystems that don't report d_type fall back to a stat.
+    // Dangling symlinks are left out, matching Path::Exists. Returns false if the directory
+    // can't be read.
+    bool ListDirectory(const Path& directory,
+                       vector<DirectoryEntry>& entries,
+                       bool querySizes = true);
+
+    // Walks a tree breadth-first, listing each level's directories in parallel on
+    // `options.pool`. The root itself isn't included and entries come back in no particular
+    // order. While the metadata cache is enabled every listed directory is recorded in it.
+    vector<ScannedEntry> ScanDirectory(const Path& root, const ScanOptions& options = {});
+
+    // Process-wide cache of directory listings produced by ScanDirectory, consulted by
+    // Path::Exists/IsFile/IsDirectory and FileReader::QueryFileSize before they stat. A fully
+    // listed directory also answers "doesn't exist" for names it doesn't contain.
+    //
+    // Entries are kept current by an inotify watch on every cached directory, so changes made
+    // by other processes become visible once the watcher thread has seen the event. Writes
+    // through Filesystem invalidate synchronously. Caching is Linux-only; elsewhere Enable()
+    // fails, nothing is recorded and every query falls through to the filesystem.
+    class MetadataCache {
+    public:
+        MetadataCache() = default;
+        ~MetadataCache();
+
+        MetadataCache(const MetadataCache&)            = delete;
+        MetadataCache& operator=(const MetadataCache&) = delete;
+
+        static MetadataCache& Global();
+
+        // Starts the watcher. Scans only populate the cache while it runs.
+        bool Enable();
+        // Stops the watcher and drops everything cached.
+        void Disable();
+        bool IsEnabled() const;
+
+        // Empty if the cache can't answer and the caller has to ask the filesystem; otherwise
+        // the metadata, with EntryType::None for a name missing from a fully listed directory.
+        std::optional<FileMetadata> Lookup(std::string_view path) const;
+
+        // Forgets what is known about `path` and its parent's listing. Call after changing a
+        // file through something other than Filesystem.
+        void Invalidate(std::string_view path);
+        void Clear();
+
+        size_t GetDirectoryCount() const;
+        size_t GetEntryCount() const;
+
+        // ScanDirectory's side of the protocol. Watch() starts watching `directory` and
+        // returns its generation, which Store() checks so a listing that raced with a change
+        // is dropped instead of cached.
+        std::optional<u64> Watch(const str& directory);
+        void Store(const str& directory, u64 generation, const vector<DirectoryEntry>& entries);
+
+    private:
+        // Lets lookups probe with string_views cut out of the query path
+        struct NameHash {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view name) const {
+                return std::hash<std::string_view> {}(name);
+            }
+        };
+
+        struct CachedDirectory {
+            u64 generation = 0;
+            bool complete  = false;
+            unordered_map<str, FileMetadata, NameHash, std::equal_to<>> entries;
+
+            void Reset();
+        };
+
+        unordered_map<str, CachedDirectory, NameHash, std::equal_to<>> _directories;
+        mutable std::shared_mutex _mutex;
+        std::atomic<bool> _enabled {false};
+        std::mutex _stateMutex;  // Serializes Enable/Disable
+
+#ifdef __linux__
+        i32 _inotifyFd = -1;
+        i32 _wakeFd    = -1;
+        unordered_map<i32, str> _watches;
+        std::mutex _watchMutex;
+        std::thread _watcher;
+
+        void WatchLoop();
+        void HandleEvent(i32 wd, u32 mask, std::string_view name);
+#endif
+
+        void InvalidateEntry(std::string_view directory, std::string_view name);
+        void ResetTree(std::string_view directory);
+    };
+}  // namespace x::Filesystem
@@ -0,0 +1,244 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "PackArchive.hpp"
+#include "Hash.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace x::Filesystem {
+    namespace {
+        u64 AlignUp(u64 value, u64 alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        struct MountEntry {
+            str archivePath;
+            str root;
+            shared_ptr<const PackArchive> archive;
+        };
+
+        std::shared_mutex gMountMutex;
+        vector<MountEntry> gMounts;
+
+        // The part of `path` below `root`, or nothing if `path` isn't under it.
+        std::optional<std::string_view> RelativeTo(std::string_view path, std::string_view root) {
+            if (path.size() <= root.size() || path.substr(0, root.size()) != root) {
+                return Empty;
+            }
+            if (root.back() == PATH_SEPARATOR) { return path.substr(root.size()); }
+            if (path[root.size()] != PATH_SEPARATOR) { return Empty; }
+            return path.substr(root.size() + 1);
+        }
+    }  // namespace
+
+#pragma region PackWriter
+    void PackWriter::Add(const str& name, vector<u8> data) {
+        _entries.push_back({PackArchive::NormalizeName(name), {}, std::move(data)});
+    }
+
+    void PackWriter::AddFile(const str& name, const Path& source) {
+        _entries.push_back({PackArchive::NormalizeName(name), source.Str(), {}});
+    }
+
+    bool PackWriter::Write(const Path& path) const {
+        struct Slot {
+            const Entry* entry;
+            u64 hash;
+        };
+
+        vector<Slot> slots;
+        slots.reserve(_entries.size());
+        for (const auto& entry : _entries) {
+            slots.push_back({&entry, Fnv1a64(entry.name)});
+        }
+        std::sort(slots.begin(), slots.end(), [](const Slot& a, const Slot& b) {
+            return a.hash != b.hash ? a.hash < b.hash : a.entry->name < b.entry->name;
+        });
+        for (size_t i = 1; i < slots.size(); ++i) {
+            if (slots[i].entry->name == slots[i - 1].entry->name) { return false; }
+        }
+
+        vector<PackIndexEntry> index(slots.size());
+        str names;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            index[i].hash       = slots[i].hash;
+            index[i].nameOffset = CAST<u32>(names.size());
+            index[i].nameLength = CAST<u32>(slots[i].entry->name.size());
+            names += slots[i].entry->name;
+        }
+
+        PackHeader header {};
+        header.magic       = kPackMagic;
+        header.version     = kPackVersion;
+        header.entryCount  = CAST<u32>(slots.size());
+        header.alignment   = kPackAlignment;
+        header.indexOffset = sizeof(PackHeader);
+        header.namesOffset = header.indexOffset + index.size() * sizeof(PackIndexEntry);
+        header.namesSize   = names.size();
+        header.dataOffset  = AlignUp(header.namesOffset + header.namesSize, kPackAlignment);
+
+        std::ofstream file(path.Str(), std::ios::binary | std::ios::trunc);
+        if (!file) { return false; }
+
+        // Data first, then the header and index once every entry's offset and size is known
+        u64 offset  = header.dataOffset;
+        u64 written = 0;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            const Entry& entry = *slots[i].entry;
+            vector<u8> loaded;
+            if (!entry.source.empty()) {
+                const Path source(entry.source);
+                loaded = FileReader::ReadAllBytes(source);
+                if (loaded.empty() && FileReader::QueryFileSize(source) != 0) { return false; }
+            }
+            const vector<u8>& data = entry.source.empty() ? entry.data : loaded;
+
+            offset = AlignUp(offset, kPackAlignment);
+            file.seekp(CAST<std::streamoff>(offset));
+            file.write(RCAST<const char*>(data.data()), CAST<std::streamsize>(data.size()));
+            index[i].offset = offset;
+            index[i].size   = data.size();
+            offset += data.size();
+            if (!data.empty()) { written = offset; }
+        }
+
+        file.seekp(0);
+        file.write(RCAST<const char*>(&header), sizeof(header));
+        file.write(RCAST<const char*>(index.data()),
+                   CAST<std::streamsize>(index.size() * sizeof(PackIndexEntry)));
+        file.write(names.data(), CAST<std::streamsize>(names.size()));
+        // Pad the tail so the last entry is backed by a whole page like every other one
+        // (and a trailing empty entry still lies inside the file)
+        const u64 end = AlignUp(offset, kPackAlignment);
+        if (end > written) {
+            file.seekp(CAST<std::streamoff>(end - 1));
+            file.put('\0');
+        }
+        return file.good();
+    }
+#pragma endregion
+
+#pragma region PackArchive
+    PackArchive::PackArchive(const Path& path) : _file(path, MappedFile::AccessHint::Random) {
+        const auto bytes = _file.Data();
+        if (bytes.size() < sizeof(PackHeader)) { return; }
+
+        const auto* header = RCAST<const PackHeader*>(bytes.data());
+        if (header->magic != kPackMagic || header->version != kPackVersion ||
+            header->indexOffset % alignof(PackIndexEntry) != 0 ||
+            header->indexOffset + u64(header->entryCount) * sizeof(PackIndexEntry) >
+              header->namesOffset ||
+            header->namesOffset + header->namesSize > bytes.size()) {
+            return;
+        }
+
+        const auto* index = RCAST<const PackIndexEntry*>(bytes.data() + header->indexOffset);
+        for (u32 i = 0; i < header->entryCount; ++i) {
+            if (index[i].offset + index[i].size > bytes.size() ||
+                u64(index[i].nameOffset) + index[i].nameLength > header->namesSize) {
+                return;
+            }
+        }
+
+        _header = header;
+        _index  = index;
+        _names  = RCAST<const char*>(bytes.data() + header->namesOffset);
+    }
+
+    bool PackArchive::Find(std::string_view name, std::span<const u8>& data) const {
+        const PackIndexEntry* entry = FindEntry(name);
+        if (!entry) { return false; }
+        data = _file.Slice(entry->offset, entry->size);
+        return true;
+    }
+
+    u32 PackArchive::GetEntryCount() const {
+        return _header ? _header->entryCount : 0;
+    }
+
+    std::string_view PackArchive::GetEntryName(u32 index) const {
+        return {_names + _index[index].nameOffset, _index[index].nameLength};
+    }
+
+    str PackArchive::NormalizeName(std::string_view name) {
+        str result(name);
+        std::replace(result.begin(), result.end(), '\\', '/');
+        size_t start = 0;
+        while (start < result.size()) {
+            if (result[start] == '/') {
+                ++start;
+            } else if (result.compare(start, 2, "./") == 0) {
+                start += 2;
+            } else {
+                break;
+            }
+        }
+        return result.substr(start);
+    }
+
+    const PackIndexEntry* PackArchive::FindEntry(std::string_view name) const {
+        if (!_header) { return None; }
+        const str normalized = NormalizeName(name);
+        const u64 hash       = Fnv1a64(normalized);
+
+        const PackIndexEntry* end = _index + _header->entryCount;
+        const PackIndexEntry* it  = std::lower_bound(
+          _index, end, hash, [](const PackIndexEntry& e, u64 h) { return e.hash < h; });
+        for (; it != end && it->hash == hash; ++it) {
+            if (std::string_view(_names + it->nameOffset, it->nameLength) == normalized) {
+                return it;
+            }
+        }
+        return None;
+    }
+#pragma endregion
+
+#pragma region Mounting
+    vector<u8> MountedFile::ReadBlock(u64 offset, size_t size) const {
+        if (size == 0 || offset >= data.size() || offset + size > data.size()) { return {}; }
+        return {data.begin() + CAST<ptrdiff_t>(offset),
+                data.begin() + CAST<ptrdiff_t>(offset + size)};
+    }
+
+    bool Mount(const Path& archive, const Path& mountPoint) {
+        auto opened = make_shared<const PackArchive>(archive);
+        if (!opened->IsOpen()) { return false; }
+        std::unique_lock lock(gMountMutex);
+        gMounts.push_back({archive.Str(), mountPoint.Str(), std::move(opened)});
+        return true;
+    }
+
+    bool Unmount(const Path& archive) {
+        std::unique_lock lock(gMountMutex);
+        const str key = archive.Str();
+        const auto it = std::find_if(gMounts.rbegin(), gMounts.rend(), [&](const auto& mount) {
+            return mount.archivePath == key;
+        });
+        if (it == gMounts.rend()) { return false; }
+        gMounts.erase(std::next(it).base());
+        return true;
+    }
+
+    void UnmountAll() {
+        std::unique_lock lock(gMountMutex);
+        gMounts.clear();
+    }
+
+    std::optional<MountedFile> FindMounted(const Path& path) {
+        std::shared_lock lock(gMountMutex);
+        if (gMounts.empty()) { return Empty; }
+
+        const str full = path.Str();
+        for (auto it = gMounts.rbegin(); it != gMounts.rend(); ++it) {
+            const auto relative = RelativeTo(full, it->root);
+            if (!relative) { continue; }
+            std::span<const u8> data;
+            if (it->archive->Find(*relative, data)) { return MountedFile {it->archive, data}; }
+        }
+        return Empty;
+    }
+#pragma endregion
+}  // namespace x::Filesystem
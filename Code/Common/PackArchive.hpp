@@ -0,0 +1,119 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+
+namespace x::Filesystem {
+    // .xpak layout: header, index sorted by name hash, name table, then each entry's data
+    // starting on a kPackAlignment boundary. Names are relative to the mount point and use
+    // '/' separators. Offsets are absolute file offsets; everything is little-endian.
+    constexpr u32 kPackMagic     = 0x4B415058;  // "XPAK"
+    constexpr u32 kPackVersion   = 1;
+    constexpr u32 kPackAlignment = 4096;
+
+    struct PackHeader {
+        u32 magic;
+        u32 version;
+        u32 entryCount;
+        u32 alignment;
+        u64 indexOffset;
+        u64 namesOffset;
+        u64 namesSize;
+        u64 dataOffset;
+    };
+    static_assert(sizeof(PackHeader) == 48);
+
+    struct PackIndexEntry {
+        u64 hash;
+        u64 offset;
+        u64 size;
+        u32 nameOffset;
+        u32 nameLength;
+    };
+    static_assert(sizeof(PackIndexEntry) == 32);
+
+    // Builds an archive. Files added by path are streamed in when the archive is written.
+    class PackWriter {
+    public:
+        void Add(const str& name, vector<u8> data);
+        void AddFile(const str& name, const Path& source);
+
+        // Returns false if a source can't be read, a name is added twice, or the output can't
+        // be written.
+        bool Write(const Path& path) const;
+
+        size_t GetEntryCount() const {
+            return _entries.size();
+        }
+
+    private:
+        struct Entry {
+            str name;
+            str source;
+            vector<u8> data;
+        };
+
+        vector<Entry> _entries;
+    };
+
+    // Read-only view of an archive. The whole file is mapped once; lookups hash the name and
+    // binary-search the index, and reads are served straight from the mapping.
+    class PackArchive {
+    public:
+        explicit PackArchive(const Path& path);
+
+        PackArchive(const PackArchive&)            = delete;
+        PackArchive& operator=(const PackArchive&) = delete;
+
+        bool IsOpen() const {
+            return _header != None;
+        }
+
+        bool Contains(std::string_view name) const {
+            return FindEntry(name) != None;
+        }
+
+        // Returns false if `name` isn't in the archive.
+        bool Find(std::string_view name, std::span<const u8>& data) const;
+
+        u32 GetEntryCount() const;
+        std::string_view GetEntryName(u32 index) const;
+
+        // '\\' -> '/', without leading separators or "./".
+        static str NormalizeName(std::string_view name);
+
+    private:
+        MappedFile _file;
+        const PackHeader* _header    = None;
+        const PackIndexEntry* _index = None;
+        const char* _names           = None;
+
+        const PackIndexEntry* FindEntry(std::string_view name) const;
+    };
+
+    // An entry resolved through the mount table. Holds the archive open while in use.
+    struct MountedFile {
+        shared_ptr<const PackArchive> archive;
+        std::span<const u8> data;
+
+        // FileReader::ReadBlock semantics: empty if the block isn't entirely inside the entry.
+        vector<u8> ReadBlock(u64 offset, size_t size) const;
+    };
+
+    // Mounted archives are consulted by FileReader, IoQueue::Read (and so the async and
+    // awaitable readers) and Path::Exists/IsFile before the loose filesystem, so packed and
+    // loose assets are interchangeable. An archive mounted at "/Game/Data" serves
+    // "/Game/Data/Textures/Rock.dds" from its "Textures/Rock.dds" entry. Later mounts shadow
+    // earlier ones.
+    bool Mount(const Path& archive, const Path& mountPoint);
+    bool Unmount(const Path& archive);
+    void UnmountAll();
+    std::optional<MountedFile> FindMounted(const Path& path);
+}  // namespace x::Filesystem
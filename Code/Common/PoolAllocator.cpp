@@ -0,0 +1,196 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "PoolAllocator.hpp"
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+
+namespace x {
+    namespace {
+        // Free blocks move around as arrays of pointers rather than intrusive lists, so
+        // handing out or taking back a batch never reads the (likely cold) blocks themselves
+        struct Batch {
+            array<void*, SmallObjectPool::kBatchSize> blocks;
+            u32 count = 0;
+        };
+
+        // Sort the shared batches once this many blocks have come back since the last sort
+        constexpr size_t kSortThreshold = 64 * SmallObjectPool::kBatchSize;
+
+        struct alignas(64) SizeClass {
+            std::mutex mutex;
+            vector<Batch> batches;
+            size_t unsorted = 0;
+        };
+
+        // Never destroyed, so threads exiting during shutdown can still hand their blocks back
+        struct SharedPool {
+            array<SizeClass, SmallObjectPool::kClassCount> classes;
+            std::atomic<u64> slabs {0};
+        };
+
+        SharedPool& GetSharedPool() {
+            static auto* pool = new SharedPool();
+            return *pool;
+        }
+
+        size_t ClassIndex(size_t bytes) {
+            constexpr size_t kGranularity = SmallObjectPool::kGranularity;
+            return (bytes + kGranularity - 1) / kGranularity - 1;
+        }
+
+        // Caller holds the class lock
+        void CarveSlab(size_t index, vector<Batch>& batches) {
+            // malloc's alignment covers kGranularity
+            static_assert(alignof(std::max_align_t) >= SmallObjectPool::kGranularity);
+            auto* slab = CAST<u8*>(std::malloc(SmallObjectPool::kSlabSize));
+            if (!slab) { throw std::bad_alloc(); }
+            GetSharedPool().slabs.fetch_add(1, std::memory_order_relaxed);
+
+            // Batches are popped from the back, so fill them back to front to hand blocks out
+            // in address order
+            const size_t blockSize = (index + 1) * SmallObjectPool::kGranularity;
+            size_t block           = SmallObjectPool::kSlabSize / blockSize;
+            while (block > 0) {
+                Batch& batch = batches.emplace_back();
+                while (block > 0 && batch.count < SmallObjectPool::kBatchSize) {
+                    batch.blocks[batch.count++] = slab + --block * blockSize;
+                }
+            }
+        }
+
+        // After a mass free (a scene unloading) the shared batches hold blocks in whatever order
+        // objects died, and handing them out like that would scatter the next scene across
+        // every slab. Sorting puts blocks back in address order, so objects allocated
+        // together land together again, as they do in fresh slabs. Caller holds the class lock.
+        void SortBatches(SizeClass& shared) {
+            ScratchScope scratch;
+            std::pmr::vector<void*> blocks(scratch.Resource());
+            blocks.reserve(shared.batches.size() * SmallObjectPool::kBatchSize);
+            for (const Batch& batch : shared.batches) {
+                const auto first = batch.blocks.begin();
+                blocks.insert(blocks.end(), first, first + batch.count);
+            }
+            // Descending, since batches and blocks are both taken from the back
+            std::sort(blocks.begin(), blocks.end(), std::greater<>());
+
+            shared.batches.clear();
+            for (size_t block = 0; block < blocks.size();) {
+                Batch& batch = shared.batches.emplace_back();
+                while (block < blocks.size() && batch.count < SmallObjectPool::kBatchSize) {
+                    batch.blocks[batch.count++] = blocks[block++];
+                }
+            }
+            shared.unsorted = 0;
+        }
+
+        // Cleared when the thread's cache is destroyed; blocks allocated or freed after that
+        // go straight through the shared pool
+        thread_local bool sCacheAlive = true;
+
+        struct ThreadCache {
+            struct Blocks {
+                array<void*, 2 * SmallObjectPool::kBatchSize> blocks;
+                u32 count = 0;
+            };
+
+            array<Blocks, SmallObjectPool::kClassCount> classes;
+
+            ~ThreadCache() {
+                sCacheAlive = false;
+                for (size_t index = 0; index < classes.size(); ++index) {
+                    Blocks& local = classes[index];
+                    while (local.count > 0) {
+                        const u32 count = std::min(local.count, SmallObjectPool::kBatchSize);
+                        Drain(index, local, count);
+                    }
+                }
+            }
+
+            static void Refill(size_t index, Blocks& local) {
+                SizeClass& shared = GetSharedPool().classes[index];
+                std::lock_guard lock(shared.mutex);
+                if (shared.unsorted >= kSortThreshold) { SortBatches(shared); }
+                if (shared.batches.empty()) { CarveSlab(index, shared.batches); }
+                const Batch& batch = shared.batches.back();
+                std::copy_n(batch.blocks.begin(), batch.count, local.blocks.begin());
+                local.count = batch.count;
+                shared.batches.pop_back();
+            }
+
+            // Hands back the `count` blocks freed longest ago.
+            static void Drain(size_t index, Blocks& local, u32 count) {
+                {
+                    SizeClass& shared = GetSharedPool().classes[index];
+                    std::lock_guard lock(shared.mutex);
+                    Batch& batch = shared.batches.emplace_back();
+                    std::copy_n(local.blocks.begin(), count, batch.blocks.begin());
+                    batch.count = count;
+                    shared.unsorted += count;
+                }
+                std::copy(local.blocks.begin() + count,
+                          local.blocks.begin() + local.count,
+                          local.blocks.begin());
+                local.count -= count;
+            }
+        };
+
+        ThreadCache* LocalCache() {
+            if (!sCacheAlive) { return None; }
+            static thread_local ThreadCache cache;
+            return &cache;
+        }
+    }  // namespace
+
+    void* SmallObjectPool::Allocate(size_t bytes) {
+        const size_t index = ClassIndex(bytes);
+        ThreadCache* cache = LocalCache();
+        if (!cache) {
+            SizeClass& shared = GetSharedPool().classes[index];
+            std::lock_guard lock(shared.mutex);
+            if (shared.batches.empty()) { CarveSlab(index, shared.batches); }
+            Batch& batch = shared.batches.back();
+            void* block  = batch.blocks[--batch.count];
+            if (batch.count == 0) { shared.batches.pop_back(); }
+            return block;
+        }
+
+        auto& local = cache->classes[index];
+        if (local.count == 0) { ThreadCache::Refill(index, local); }
+        return local.blocks[--local.count];
+    }
+
+    void SmallObjectPool::Free(void* memory, size_t bytes) {
+        if (!memory) { return; }
+        const size_t index = ClassIndex(bytes);
+        ThreadCache* cache = LocalCache();
+        if (!cache) {
+            SizeClass& shared = GetSharedPool().classes[index];
+            std::lock_guard lock(shared.mutex);
+            if (shared.batches.empty() || shared.batches.back().count == kBatchSize) {
+                shared.batches.emplace_back();
+            }
+            Batch& batch                = shared.batches.back();
+            batch.blocks[batch.count++] = memory;
+            ++shared.unsorted;
+            return;
+        }
+
+        auto& local = cache->classes[index];
+        // Also keeps a thread that frees what others allocate from hoarding blocks
+        if (local.count == local.blocks.size()) { ThreadCache::Drain(index, local, kBatchSize); }
+        local.blocks[local.count++] = memory;
+    }
+
+    SmallObjectPoolStats SmallObjectPool::GetStats() {
+        SmallObjectPoolStats stats;
+        stats.slabs         = GetSharedPool().slabs.load(std::memory_order_relaxed);
+        stats.reservedBytes = stats.slabs * kSlabSize;
+        return stats;
+    }
+}  // namespace x
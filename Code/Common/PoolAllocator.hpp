@@ -0,0 +1,93 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "MemoryTracker.hpp"
+
+namespace x {
+    struct SmallObjectPoolStats {
+        u64 reservedBytes = 0;  // Slab memory, live or cached
+        u64 slabs         = 0;
+    };
+
+    // Fixed-size blocks in size classes of kGranularity bytes, carved from slabs so objects
+    // allocated together sit together. Each thread keeps a small stack of free blocks per class
+    // and only takes the class lock to trade a batch with the shared pool, so allocating and
+    // freeing are a few pointer moves. Blocks may be freed on any thread. Slabs are kept for reuse
+    // until exit and are not tracked; PoolAllocator charges the objects to their tag instead.
+    class SmallObjectPool {
+    public:
+        static constexpr size_t kGranularity  = 16;  // Also the alignment of every block
+        static constexpr size_t kMaxBlockSize = 512;
+        static constexpr size_t kClassCount   = kMaxBlockSize / kGranularity;
+        static constexpr size_t kSlabSize     = 64 << 10;
+        static constexpr u32 kBatchSize       = 32;  // Blocks moved per trip to the shared pool
+
+        static constexpr bool Supports(size_t bytes, size_t alignment) {
+            return bytes > 0 && bytes <= kMaxBlockSize && alignment <= kGranularity;
+        }
+
+        // `bytes` must pass Supports(), and Free() must get the same size back.
+        static void* Allocate(size_t bytes);
+        static void Free(void* memory, size_t bytes);
+
+        static SmallObjectPoolStats GetStats();
+    };
+
+    // Single objects that fit a pool block come from SmallObjectPool; arrays and anything
+    // larger fall back to MemoryTracker. Both are charged to `Tag`. Suits node-based containers
+    // and allocate_shared, which allocate one fixed-size object at a time.
+    template<typename T, MemoryTag Tag>
+    class PoolAllocator {
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind {
+            using other = PoolAllocator<U, Tag>;
+        };
+
+        PoolAllocator() = default;
+
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U, Tag>&) {}
+
+        T* allocate(size_t count) {
+            if (count == 1 && SmallObjectPool::Supports(sizeof(T), alignof(T))) {
+                MemoryTracker::Track(Tag, sizeof(T));
+                return CAST<T*>(SmallObjectPool::Allocate(sizeof(T)));
+            }
+            if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+                throw std::bad_array_new_length();
+            }
+            return CAST<T*>(MemoryTracker::Allocate(Tag, count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* memory, size_t count) {
+            if (count == 1 && SmallObjectPool::Supports(sizeof(T), alignof(T))) {
+                MemoryTracker::Untrack(Tag, sizeof(T));
+                SmallObjectPool::Free(memory, sizeof(T));
+                return;
+            }
+            MemoryTracker::Free(Tag, memory, count * sizeof(T), alignof(T));
+        }
+
+        template<typename U>
+        bool operator==(const PoolAllocator<U, Tag>&) const {
+            return true;
+        }
+    };
+
+    template<typename K, typename V, MemoryTag Tag, typename Hash = std::hash<K>>
+    using PooledUnorderedMap =
+      std::unordered_map<K, V, Hash, std::equal_to<K>, PoolAllocator<std::pair<const K, V>, Tag>>;
+
+    // make_shared with the object and its control block in one pool block.
+    template<typename T, MemoryTag Tag, typename... Args>
+    shared_ptr<T> MakePooledShared(Args&&... args) {
+        return std::allocate_shared<T>(PoolAllocator<T, Tag>(), std::forward<Args>(args)...);
+    }
+}  // namespace x
@@ -0,0 +1,236 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace x {
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        const Clock::time_point kEpoch = Clock::now();
+
+        // Marks the thread's buffer as exited so Collect() can drop it once drained
+        struct ThreadExit {
+            std::atomic<bool>* exited = None;
+
+            ~ThreadExit() {
+                if (exited) { exited->store(true, std::memory_order_release); }
+            }
+        };
+
+        void AppendEscaped(str& out, std::string_view text) {
+            for (const char c : text) {
+                switch (c) {
+                    case '"':
+                        out += "\\\"";
+                        break;
+                    case '\\':
+                        out += "\\\\";
+                        break;
+                    default:
+                        if (CAST<u8>(c) < 0x20) {
+                            char escaped[8];
+                            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                            out += escaped;
+                        } else {
+                            out += c;
+                        }
+                }
+            }
+        }
+    }  // namespace
+
+    thread_local Profiler::ThreadBuffer* Profiler::sBuffer = None;
+    thread_local const char* Profiler::sThreadName        = None;
+
+    Profiler& Profiler::Global() {
+        // Never destroyed, so threads that exit during shutdown can still reach it
+        static auto* profiler = new Profiler();
+        return *profiler;
+    }
+
+    u64 Profiler::Now() {
+        return CAST<u64>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - kEpoch).count());
+    }
+
+    void Profiler::SetThreadName(const char* name) {
+        sThreadName = name;
+        if (sBuffer) {
+            auto& profiler = Global();
+            std::lock_guard lock(profiler._mutex);
+            profiler._threadNames[sBuffer->id] = name;
+        }
+    }
+
+    void Profiler::Record(const char* name, u64 start, u64 end, u32 depth) {
+        ThreadBuffer& buffer = LocalBuffer();
+        const u64 head       = buffer.head.load(std::memory_order_relaxed);
+        if (head - buffer.tail.load(std::memory_order_acquire) >= kEventsPerThread) {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buffer.events[head % kEventsPerThread] = {name, start, end, depth};
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+
+    void Profiler::Collect() {
+        std::lock_guard lock(_mutex);
+        CollectLocked();
+    }
+
+    void Profiler::BeginCapture() {
+        std::lock_guard lock(_mutex);
+        // Whatever was recorded before the capture started doesn't belong in it
+        _capturing = false;
+        CollectLocked();
+        _captured.clear();
+        _capturing = true;
+    }
+
+    void Profiler::EndCapture() {
+        std::lock_guard lock(_mutex);
+        CollectLocked();
+        _capturing = false;
+    }
+
+    bool Profiler::WriteChromeTrace(const Filesystem::Path& path) {
+        str json = R"({"displayTimeUnit":"ns","traceEvents":[)";
+        {
+            std::lock_guard lock(_mutex);
+            CollectLocked();
+            json.reserve(json.size() + _captured.size() * 96);
+
+            bool first = true;
+            for (const auto& [id, name] : _threadNames) {
+                json += first ? "" : ",";
+                json += R"({"ph":"M","pid":1,"tid":)" + std::to_string(id) +
+                        R"(,"name":"thread_name","args":{"name":")";
+                AppendEscaped(json, name);
+                json += "\"}}";
+                first = false;
+            }
+
+            char numbers[96];
+            for (const auto& [event, thread] : _captured) {
+                json += first ? "" : ",";
+                json += R"({"ph":"X","pid":1,"name":")";
+                AppendEscaped(json, event.name);
+                // Microseconds, as the format requires, keeping nanosecond precision
+                snprintf(numbers,
+                         sizeof(numbers),
+                         R"(","tid":%u,"ts":%llu.%03llu,"dur":%llu.%03llu})",
+                         thread,
+                         CAST<unsigned long long>(event.start / 1000),
+                         CAST<unsigned long long>(event.start % 1000),
+                         CAST<unsigned long long>((event.end - event.start) / 1000),
+                         CAST<unsigned long long>((event.end - event.start) % 1000));
+                json += numbers;
+                first = false;
+            }
+        }
+        json += "]}\n";
+        return Filesystem::FileWriter::WriteAllText(path, json);
+    }
+
+    vector<ProfileMarkerStats> Profiler::GetSummary() {
+        vector<ProfileMarkerStats> summary;
+        std::lock_guard lock(_mutex);
+        CollectLocked();
+        summary.reserve(_markers.size());
+
+        vector<u64> window;
+        for (const auto& [name, history] : _markers) {
+            const auto samples = CAST<size_t>(std::min<u64>(history.count, kSummaryWindow));
+            window.assign(history.durations.begin(),
+                          history.durations.begin() + CAST<ptrdiff_t>(samples));
+
+            ProfileMarkerStats stats;
+            stats.name  = str(name);
+            stats.count = history.count;
+            u64 total   = 0;
+            for (const u64 duration : window) {
+                total += duration;
+            }
+            const auto [min, max] = std::minmax_element(window.begin(), window.end());
+            stats.minNs           = *min;
+            stats.maxNs           = *max;
+            stats.avgNs           = total / samples;
+            // Nearest rank
+            const size_t rank = (samples * 99 + 99) / 100 - 1;
+            std::nth_element(window.begin(), window.begin() + CAST<ptrdiff_t>(rank), window.end());
+            stats.p99Ns = window[rank];
+            summary.push_back(std::move(stats));
+        }
+        std::sort(summary.begin(), summary.end(), [](const auto& a, const auto& b) {
+            return a.p99Ns > b.p99Ns;
+        });
+        return summary;
+    }
+
+    void Profiler::ResetSummary() {
+        std::lock_guard lock(_mutex);
+        CollectLocked();
+        _markers.clear();
+    }
+
+    u64 Profiler::GetDroppedCount() {
+        std::lock_guard lock(_mutex);
+        CollectLocked();
+        return _dropped;
+    }
+
+    Profiler::ThreadBuffer& Profiler::LocalBuffer() {
+        if (!sBuffer) { sBuffer = Global().Register(); }
+        return *sBuffer;
+    }
+
+    Profiler::ThreadBuffer* Profiler::Register() {
+        static thread_local ThreadExit threadExit;
+        auto buffer       = make_unique<ThreadBuffer>();
+        threadExit.exited = &buffer->exited;
+
+        std::lock_guard lock(_mutex);
+        buffer->id = _nextThreadId++;
+        if (sThreadName) { _threadNames[buffer->id] = sThreadName; }
+        _threads.push_back(std::move(buffer));
+        return _threads.back().get();
+    }
+
+    void Profiler::CollectLocked() {
+        for (auto it = _threads.begin(); it != _threads.end();) {
+            ThreadBuffer& buffer = **it;
+            // Read before draining: once set, the thread writes nothing more
+            const bool exited = buffer.exited.load(std::memory_order_acquire);
+            const u64 tail    = buffer.tail.load(std::memory_order_relaxed);
+            const u64 head    = buffer.head.load(std::memory_order_acquire);
+            for (u64 index = tail; index < head; ++index) {
+                const ProfileEvent& event = buffer.events[index % kEventsPerThread];
+
+                MarkerHistory& history = _markers[event.name];
+                history.durations[history.count % kSummaryWindow] = event.end - event.start;
+                ++history.count;
+
+                if (!_capturing) { continue; }
+                if (_captured.size() < kMaxCapturedEvents) {
+                    _captured.push_back({event, buffer.id});
+                } else {
+                    ++_dropped;
+                }
+            }
+            buffer.tail.store(head, std::memory_order_release);
+            _dropped += buffer.dropped.exchange(0, std::memory_order_relaxed);
+
+            if (exited) {
+                it = _threads.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}  // namespace x
@@ -0,0 +1,173 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include <atomic>
+#include <mutex>
+#include <string_view>
+
+// Markers compile to nothing unless X_ENABLE_PROFILING is defined. When compiled in, a
+// disabled marker costs one relaxed load and a branch.
+#ifdef X_ENABLE_PROFILING
+    #define X_PROFILE_CONCAT_INNER(a, b) a##b
+    #define X_PROFILE_CONCAT(a, b) X_PROFILE_CONCAT_INNER(a, b)
+    // `name` must outlive the profiler, e.g. a string literal.
+    #define X_PROFILE_SCOPE(name) \
+        const ::x::ProfileScope X_PROFILE_CONCAT(xProfileScope, __LINE__)(name)
+    #define X_PROFILE_FUNCTION() X_PROFILE_SCOPE(__func__)
+    #define X_PROFILE_THREAD(name) ::x::Profiler::SetThreadName(name)
+#else
+    #define X_PROFILE_SCOPE(name) ((void)0)
+    #define X_PROFILE_FUNCTION() ((void)0)
+    #define X_PROFILE_THREAD(name) ((void)0)
+#endif
+
+namespace x {
+    namespace detail {
+        inline std::atomic<bool> gProfilingEnabled {false};
+    }
+
+    struct ProfileEvent {
+        const char* name;
+        u64 start;  // Nanoseconds since the profiler started
+        u64 end;
+        u32 depth;  // Markers open on the same thread when this one began
+    };
+
+    // Durations over the last Profiler::kSummaryWindow samples of one marker.
+    struct ProfileMarkerStats {
+        str name;
+        u64 count = 0;  // Every sample since the last ResetSummary()
+        u64 minNs = 0;
+        u64 avgNs = 0;
+        u64 p99Ns = 0;
+        u64 maxNs = 0;
+    };
+
+    // Each thread writes finished markers into its own single-producer ring, without locks or
+    // allocation; Collect() drains the rings into the per-marker summary and, while capturing,
+    // a trace. A full ring drops events rather than blocking, so collect at least once a frame.
+    class Profiler {
+    public:
+        // 1 MB per thread, allocated the first time a marker fires on it
+        static constexpr u32 kEventsPerThread   = 1u << 15;
+        static constexpr u32 kSummaryWindow     = 1024;
+        static constexpr u64 kMaxCapturedEvents = 1ull << 22;
+
+        static Profiler& Global();
+
+        Profiler(const Profiler&)            = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        static void Enable() {
+            detail::gProfilingEnabled.store(true, std::memory_order_relaxed);
+        }
+
+        static void Disable() {
+            detail::gProfilingEnabled.store(false, std::memory_order_relaxed);
+        }
+
+        static bool IsEnabled() {
+            return detail::gProfilingEnabled.load(std::memory_order_relaxed);
+        }
+
+        // Nanoseconds on the profiler's clock.
+        static u64 Now();
+
+        // Names the calling thread in traces. Doesn't allocate the thread's ring.
+        static void SetThreadName(const char* name);
+
+        // Called by ProfileScope.
+        static void Record(const char* name, u64 start, u64 end, u32 depth);
+
+        // Drains every thread's ring. Call once a frame, or more often under heavy load.
+        void Collect();
+
+        // Trace events are kept from BeginCapture() until EndCapture(), up to
+        // kMaxCapturedEvents. Beginning a capture discards the previous one.
+        void BeginCapture();
+        void EndCapture();
+
+        // Collects, then writes the captured events in the Chrome trace event format, which
+        // chrome://tracing and Perfetto both load.
+        bool WriteChromeTrace(const Filesystem::Path& path);
+
+        // Collects, then summarizes every marker seen, slowest p99 first.
+        vector<ProfileMarkerStats> GetSummary();
+        void ResetSummary();
+
+        // Events lost to full rings or a full capture.
+        u64 GetDroppedCount();
+
+    private:
+        struct ThreadBuffer {
+            array<ProfileEvent, kEventsPerThread> events;
+            std::atomic<u64> head {0};  // Written by the owning thread
+            std::atomic<u64> tail {0};  // Written by Collect()
+            std::atomic<u64> dropped {0};
+            std::atomic<bool> exited {false};
+            u32 id = 0;
+        };
+
+        struct CapturedEvent {
+            ProfileEvent event;
+            u32 thread;
+        };
+
+        struct MarkerHistory {
+            u64 count = 0;
+            array<u64, kSummaryWindow> durations {};
+        };
+
+        std::mutex _mutex;
+        vector<unique_ptr<ThreadBuffer>> _threads;
+        // Thread names outlive their buffers so a trace still labels exited threads
+        unordered_map<u32, str> _threadNames;
+        u32 _nextThreadId = 1;
+        unordered_map<std::string_view, MarkerHistory> _markers;
+        vector<CapturedEvent> _captured;
+        bool _capturing = false;
+        u64 _dropped    = 0;
+
+        static thread_local ThreadBuffer* sBuffer;
+        static thread_local const char* sThreadName;
+
+        Profiler() = default;
+
+        static ThreadBuffer& LocalBuffer();
+        ThreadBuffer* Register();
+        void CollectLocked();
+    };
+
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char* name) {
+            if (Profiler::IsEnabled()) {
+                _name  = name;
+                _depth = sDepth++;
+                _start = Profiler::Now();
+            }
+        }
+
+        ~ProfileScope() {
+            if (_name) {
+                Profiler::Record(_name, _start, Profiler::Now(), _depth);
+                --sDepth;
+            }
+        }
+
+        ProfileScope(const ProfileScope&)            = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        static inline thread_local u32 sDepth = 0;
+
+        const char* _name = None;
+        u64 _start        = 0;
+        u32 _depth        = 0;
+    };
+}  // namespace x
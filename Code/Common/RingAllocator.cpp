@@ -0,0 +1,49 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "RingAllocator.hpp"
+
+namespace x {
+    RingAllocator::RingAllocator(u64 capacity) : _capacity(capacity) {}
+
+    std::optional<RingAllocator::Allocation> RingAllocator::Allocate(u64 size, u64 alignment) {
+        if (size == 0 || size > _capacity) return Empty;
+
+        u64 offset   = AlignUp(_head, alignment);
+        u64 consumed = offset - _head + size;
+        bool wrapped = false;
+        if (offset + size > _capacity) {
+            // Waste the tail end of the ring and restart at 0, which satisfies any alignment
+            offset   = 0;
+            consumed = _capacity - _head + size;
+            wrapped  = true;
+        }
+
+        // The free region is exactly (capacity - used) bytes starting at the head, so the
+        // allocation plus any skipped bytes must fit inside it to avoid overrunning live frames
+        if (GetUsed() + consumed > _capacity) return Empty;
+
+        _head = offset + size;
+        _allocatedTotal += consumed;
+        return Allocation {offset, size, wrapped};
+    }
+
+    void RingAllocator::EndFrame(u64 frameId) {
+        _fences.push_back({frameId, _head, _allocatedTotal});
+    }
+
+    void RingAllocator::Retire(u64 completedFrameId) {
+        while (!_fences.empty() && _fences.front().frameId <= completedFrameId) {
+            _retiredTotal = _fences.front().allocatedTotal;
+            _fences.pop_front();
+        }
+    }
+
+    void RingAllocator::Reset() {
+        _head           = 0;
+        _allocatedTotal = 0;
+        _retiredTotal   = 0;
+        _fences.clear();
+    }
+}  // namespace x
@@ -0,0 +1,73 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <deque>
+
+namespace x {
+    // Offset-only ring suballocator with per-frame fences. It never touches memory itself,
+    // so the same bookkeeping drives GPU upload rings and can be exercised headlessly.
+    //
+    // Allocations are handed out linearly from the head. When an allocation does not fit
+    // before the end of the ring it wraps to offset 0 and is flagged `wrapped`, signalling
+    // the owner to discard/rename the backing memory. Space is only reclaimed once the
+    // frame that allocated it has been retired.
+    class RingAllocator {
+    public:
+        struct Allocation {
+            u64 offset;
+            u64 size;
+            bool wrapped;
+        };
+
+        explicit RingAllocator(u64 capacity);
+
+        std::optional<Allocation> Allocate(u64 size, u64 alignment = 1);
+
+        // Closes the current frame; everything allocated since the last fence belongs to it.
+        void EndFrame(u64 frameId);
+
+        // Releases all space owned by frames up to and including `completedFrameId`.
+        void Retire(u64 completedFrameId);
+
+        // Drops all allocations and fences.
+        void Reset();
+
+        u64 GetCapacity() const {
+            return _capacity;
+        }
+
+        u64 GetUsed() const {
+            return _allocatedTotal - _retiredTotal;
+        }
+
+        u64 GetHead() const {
+            return _head;
+        }
+
+        size_t GetPendingFrameCount() const {
+            return _fences.size();
+        }
+
+        static u64 AlignUp(u64 value, u64 alignment) {
+            if (alignment <= 1) return value;
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+    private:
+        struct Fence {
+            u64 frameId;
+            u64 head;
+            u64 allocatedTotal;
+        };
+
+        u64 _capacity;
+        u64 _head           = 0;
+        u64 _allocatedTotal = 0;  // Monotonic, includes padding lost to alignment and wrapping
+        u64 _retiredTotal   = 0;
+        std::deque<Fence> _fences;
+    };
+}  // namespace x
@@ -0,0 +1,218 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+namespace x {
+    // Vector that keeps its first N elements inside the object and only goes to `Allocator`
+    // beyond that. Follows std::vector's interface and invalidation rules, except that moving
+    // an inline vector moves its elements instead of the storage.
+    template<typename T, size_t N, typename Allocator = std::allocator<T>>
+    class SmallVector {
+        static_assert(N > 0, "Use a vector when nothing is stored inline");
+        using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    public:
+        using value_type     = T;
+        using size_type      = size_t;
+        using iterator       = T*;
+        using const_iterator = const T*;
+
+        SmallVector() = default;
+
+        SmallVector(const SmallVector& other) {
+            reserve(other._size);
+            std::uninitialized_copy(other.begin(), other.end(), _data);
+            _size = other._size;
+        }
+
+        SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            MoveFrom(other);
+        }
+
+        ~SmallVector() {
+            clear();
+            ReleaseHeap();
+        }
+
+        SmallVector& operator=(const SmallVector& other) {
+            if (this != &other) {
+                clear();
+                reserve(other._size);
+                std::uninitialized_copy(other.begin(), other.end(), _data);
+                _size = other._size;
+            }
+            return *this;
+        }
+
+        SmallVector& operator=(SmallVector&& other) noexcept(
+          std::is_nothrow_move_constructible_v<T>) {
+            if (this != &other) {
+                clear();
+                ReleaseHeap();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+
+        iterator begin() {
+            return _data;
+        }
+
+        iterator end() {
+            return _data + _size;
+        }
+
+        const_iterator begin() const {
+            return _data;
+        }
+
+        const_iterator end() const {
+            return _data + _size;
+        }
+
+        T* data() {
+            return _data;
+        }
+
+        const T* data() const {
+            return _data;
+        }
+
+        size_t size() const {
+            return _size;
+        }
+
+        size_t capacity() const {
+            return _capacity;
+        }
+
+        bool empty() const {
+            return _size == 0;
+        }
+
+        // True while the elements fit inline.
+        bool IsInline() const {
+            return _data == InlineData();
+        }
+
+        T& operator[](size_t index) {
+            return _data[index];
+        }
+
+        const T& operator[](size_t index) const {
+            return _data[index];
+        }
+
+        T& front() {
+            return _data[0];
+        }
+
+        T& back() {
+            return _data[_size - 1];
+        }
+
+        const T& back() const {
+            return _data[_size - 1];
+        }
+
+        void reserve(size_t capacity) {
+            if (capacity > _capacity) { Reallocate(capacity); }
+        }
+
+        template<typename... Args>
+        T& emplace_back(Args&&... args) {
+            if (_size == _capacity) {
+                // Built first, in case the arguments refer to elements about to move
+                T value(std::forward<Args>(args)...);
+                Reallocate(_capacity * 2);
+                return *std::construct_at(_data + _size++, std::move(value));
+            }
+            return *std::construct_at(_data + _size++, std::forward<Args>(args)...);
+        }
+
+        void push_back(const T& value) {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value) {
+            emplace_back(std::move(value));
+        }
+
+        void pop_back() {
+            std::destroy_at(_data + --_size);
+        }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            const auto target = _data + (first - _data);
+            const auto count  = CAST<size_t>(last - first);
+            if (count > 0) {
+                std::move(target + count, end(), target);
+                std::destroy(end() - count, end());
+                _size -= count;
+            }
+            return target;
+        }
+
+        iterator erase(const_iterator position) {
+            return erase(position, position + 1);
+        }
+
+        void clear() {
+            std::destroy(begin(), end());
+            _size = 0;
+        }
+
+    private:
+        alignas(T) u8 _inline[sizeof(T) * N];
+        T* _data         = InlineData();
+        size_t _size     = 0;
+        size_t _capacity = N;
+        [[no_unique_address]] Allocator _allocator;
+
+        T* InlineData() {
+            return RCAST<T*>(_inline);
+        }
+
+        const T* InlineData() const {
+            return RCAST<const T*>(_inline);
+        }
+
+        void Reallocate(size_t capacity) {
+            T* memory = AllocatorTraits::allocate(_allocator, capacity);
+            std::uninitialized_move(begin(), end(), memory);
+            std::destroy(begin(), end());
+            ReleaseHeap();
+            _data     = memory;
+            _capacity = capacity;
+        }
+
+        void ReleaseHeap() {
+            if (!IsInline()) { AllocatorTraits::deallocate(_allocator, _data, _capacity); }
+            _data     = InlineData();
+            _capacity = N;
+        }
+
+        // Expects this vector empty and inline.
+        void MoveFrom(SmallVector& other) {
+            if (other.IsInline()) {
+                std::uninitialized_move(other.begin(), other.end(), _data);
+                _size = other._size;
+                other.clear();
+            } else {
+                _data           = other._data;
+                _size           = other._size;
+                _capacity       = other._capacity;
+                other._data     = other.InlineData();
+                other._size     = 0;
+                other._capacity = N;
+            }
+        }
+    };
+}  // namespace x
@@ -0,0 +1,28 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Task.hpp"
+
+namespace x {
+    void ManualExecutor::Schedule(std::coroutine_handle<> handle) {
+        std::lock_guard lock(_mutex);
+        _pending.push_back(handle);
+    }
+
+    u32 ManualExecutor::RunPending() {
+        std::deque<std::coroutine_handle<>> pending;
+        {
+            std::lock_guard lock(_mutex);
+            pending.swap(_pending);
+        }
+        for (const auto handle : pending) {
+            handle.resume();
+        }
+        return CAST<u32>(pending.size());
+    }
+
+    void ThreadPoolExecutor::Schedule(std::coroutine_handle<> handle) {
+        _pool.Enqueue([handle]() { handle.resume(); });
+    }
+}  // namespace x
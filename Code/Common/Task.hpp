@@ -0,0 +1,236 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "ThreadPool.hpp"
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace x {
+    // Where coroutines resume after an awaited operation completes.
+    class Executor {
+    public:
+        virtual ~Executor() = default;
+
+        virtual void Schedule(std::coroutine_handle<> handle) = 0;
+    };
+
+    // Resumes on whichever thread completed the operation.
+    class InlineExecutor final : public Executor {
+    public:
+        void Schedule(std::coroutine_handle<> handle) override {
+            handle.resume();
+        }
+    };
+
+    // Queues resumptions until the owner drains them, e.g. once per frame on the main thread.
+    class ManualExecutor final : public Executor {
+    public:
+        void Schedule(std::coroutine_handle<> handle) override;
+
+        // Resumes everything queued so far; returns how many coroutines ran.
+        u32 RunPending();
+
+    private:
+        std::mutex _mutex;
+        std::deque<std::coroutine_handle<>> _pending;
+    };
+
+    class ThreadPoolExecutor final : public Executor {
+    public:
+        explicit ThreadPoolExecutor(ThreadPool& pool) : _pool(pool) {}
+
+        void Schedule(std::coroutine_handle<> handle) override;
+
+    private:
+        ThreadPool& _pool;
+    };
+
+    // `co_await ResumeOn(executor)` moves the rest of the coroutine onto `executor`.
+    inline auto ResumeOn(Executor& executor) {
+        struct Awaiter {
+            Executor& executor;
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+            void await_suspend(std::coroutine_handle<> handle) const {
+                executor.Schedule(handle);
+            }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter {executor};
+    }
+
+    template<typename T>
+    class Task;
+
+    namespace detail {
+        struct TaskPromiseBase {
+            std::coroutine_handle<> continuation;
+            std::exception_ptr error;
+
+            struct FinalAwaiter {
+                bool await_ready() const noexcept {
+                    return false;
+                }
+                template<typename Promise>
+                std::coroutine_handle<>
+                await_suspend(std::coroutine_handle<Promise> handle) const noexcept {
+                    const auto continuation = handle.promise().continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept {
+                return {};
+            }
+            FinalAwaiter final_suspend() const noexcept {
+                return {};
+            }
+            void unhandled_exception() {
+                error = std::current_exception();
+            }
+        };
+
+        template<typename T>
+        struct TaskPromise : TaskPromiseBase {
+            std::optional<T> value;
+
+            Task<T> get_return_object();
+
+            template<typename U>
+            void return_value(U&& result) {
+                value.emplace(std::forward<U>(result));
+            }
+
+            T TakeResult() {
+                if (error) { std::rethrow_exception(error); }
+                return std::move(*value);
+            }
+        };
+
+        template<>
+        struct TaskPromise<void> : TaskPromiseBase {
+            Task<void> get_return_object();
+
+            void return_void() const noexcept {}
+
+            void TakeResult() const {
+                if (error) { std::rethrow_exception(error); }
+            }
+        };
+
+        // Fire-and-forget coroutine that starts eagerly and frees itself when done.
+        struct DetachedTask {
+            struct promise_type {
+                DetachedTask get_return_object() const noexcept {
+                    return {};
+                }
+                std::suspend_never initial_suspend() const noexcept {
+                    return {};
+                }
+                std::suspend_never final_suspend() const noexcept {
+                    return {};
+                }
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept {
+                    std::terminate();
+                }
+            };
+        };
+    }  // namespace detail
+
+    // Lazily started coroutine. Nothing runs until the task is awaited (or passed to
+    // SyncWait/Detach); the awaiting coroutine resumes when it finishes, and exceptions
+    // propagate to it.
+    template<typename T = void>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = detail::TaskPromise<T>;
+
+        explicit Task(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+        ~Task() {
+            if (_handle) { _handle.destroy(); }
+        }
+
+        Task(const Task&)            = delete;
+        Task& operator=(const Task&) = delete;
+
+        Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (_handle) { _handle.destroy(); }
+                _handle = std::exchange(other._handle, {});
+            }
+            return *this;
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            _handle.promise().continuation = awaiting;
+            return _handle;
+        }
+
+        T await_resume() {
+            return _handle.promise().TakeResult();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> _handle;
+    };
+
+    namespace detail {
+        template<typename T>
+        Task<T> TaskPromise<T>::get_return_object() {
+            return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() {
+            return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+        }
+
+        template<typename T>
+        DetachedTask RunInto(Task<T> task, std::promise<T>& promise) {
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    co_await task;
+                    promise.set_value();
+                } else {
+                    promise.set_value(co_await task);
+                }
+            } catch (...) { promise.set_exception(std::current_exception()); }
+        }
+
+        inline DetachedTask RunDetached(Task<void> task) {
+            co_await task;
+        }
+    }  // namespace detail
+
+    // Starts `task` and blocks the calling thread until it completes. Meant for tools, tests
+    // and top-level entry points; engine code should co_await instead.
+    template<typename T>
+    T SyncWait(Task<T> task) {
+        std::promise<T> promise;
+        auto future = promise.get_future();
+        detail::RunInto(std::move(task), promise);
+        return future.get();
+    }
+
+    // Starts `task` without waiting for it. An escaping exception terminates the program.
+    inline void Detach(Task<void> task) {
+        detail::RunDetached(std::move(task));
+    }
+}  // namespace x
@@ -0,0 +1,71 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "ThreadPool.hpp"
+#include "Profiler.hpp"
+
+namespace x {
+    ThreadPool::ThreadPool(u32 threadCount) {
+        if (threadCount == 0) threadCount = 1;
+        _workers.reserve(threadCount);
+        for (u32 i = 0; i < threadCount; ++i) {
+            _workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _taskAvailable.notify_all();
+        for (auto& worker : _workers) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    void ThreadPool::Enqueue(std::function<void()> task) {
+        // Notify under the lock: a task that resumes a coroutine can complete and let the
+        // owner destroy the pool before an unlocked notify from this thread runs.
+        std::lock_guard lock(_mutex);
+        _tasks.push_back(std::move(task));
+        _taskAvailable.notify_one();
+    }
+
+    void ThreadPool::WaitIdle() {
+        std::unique_lock lock(_mutex);
+        _idle.wait(lock, [this]() { return _tasks.empty() && _activeTasks == 0; });
+    }
+
+    u32 ThreadPool::DefaultThreadCount() {
+        const u32 hardwareThreads = std::thread::hardware_concurrency();
+        return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+
+    void ThreadPool::WorkerLoop() {
+        X_PROFILE_THREAD("ThreadPool");
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(_mutex);
+                _taskAvailable.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+                if (_tasks.empty()) return;  // Only reached when stopping
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+                ++_activeTasks;
+            }
+
+            {
+                X_PROFILE_SCOPE("ThreadPool::Task");
+                task();
+            }
+
+            {
+                std::lock_guard lock(_mutex);
+                --_activeTasks;
+                if (_tasks.empty() && _activeTasks == 0) _idle.notify_all();
+            }
+        }
+    }
+}  // namespace x
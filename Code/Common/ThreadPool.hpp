@@ -0,0 +1,57 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace x {
+    // Fixed set of worker threads consuming a FIFO task queue.
+    class ThreadPool {
+    public:
+        explicit ThreadPool(u32 threadCount = DefaultThreadCount());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        template<typename Func>
+        auto Submit(Func&& func) -> std::future<decltype(func())> {
+            using ReturnType = decltype(func());
+            auto task =
+              std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Func>(func));
+            std::future<ReturnType> future = task->get_future();
+            Enqueue([task]() { (*task)(); });
+            return future;
+        }
+
+        void Enqueue(std::function<void()> task);
+
+        // Blocks until the queue is empty and every worker is idle.
+        void WaitIdle();
+
+        u32 GetThreadCount() const {
+            return CAST<u32>(_workers.size());
+        }
+
+        static u32 DefaultThreadCount();
+
+    private:
+        vector<std::thread> _workers;
+        std::deque<std::function<void()>> _tasks;
+        std::mutex _mutex;
+        std::condition_variable _taskAvailable;
+        std::condition_variable _idle;
+        u32 _activeTasks = 0;
+        bool _stopping   = false;
+
+        void WorkerLoop();
+    };
+}  // namespace x
@@ -0,0 +1,397 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "TlsfAllocator.hpp"
+#include "Panic.inl"
+
+#include <algorithm>
+#include <bit>
+
+namespace x {
+    TlsfAllocator::TlsfAllocator(u32 capacity) : _capacity(capacity) {
+        Reset();
+    }
+
+    TlsfAllocator::Handle TlsfAllocator::Allocate(u32 size, u32 alignment) {
+        if (size == 0 || size > _capacity - _used) return kInvalidHandle;
+        if (alignment == 0 || !std::has_single_bit(alignment)) return kInvalidHandle;
+
+        // Any block this large has an aligned offset with `size` units after it
+        const u64 search = u64(size) + alignment - 1;
+        if (search > _capacity) return kInvalidHandle;
+
+        u32 firstLevel, secondLevel;
+        u32 index = FindFree(CAST<u32>(search), firstLevel, secondLevel);
+        if (index == kNullBlock) return kInvalidHandle;
+        RemoveFree(index);
+
+        // Leave the padding in front free and allocate from the aligned remainder. The block
+        // before a free block is never free, so this can't leave two free blocks side by side.
+        const u32 offset = _blocks[index].offset;
+        const u32 pad    = ((offset + alignment - 1) & ~(alignment - 1)) - offset;
+        if (pad > 0) {
+            const u32 aligned = SplitAfter(index, pad);
+            InsertFree(index);
+            index = aligned;
+        }
+
+        // Return the unused tail of the block to the free lists
+        if (_blocks[index].size > size) { InsertFree(SplitAfter(index, size)); }
+
+        // Generation 0 marks blocks that aren't live allocations
+        if (++_generation == 0) { _generation = 1; }
+        _blocks[index].free       = false;
+        _blocks[index].alignment  = alignment;
+        _blocks[index].generation = _generation;
+        _used += size;
+        ++_allocationCount;
+        return MakeHandle(index);
+    }
+
+    void TlsfAllocator::Free(Handle handle) {
+        u32 index = Resolve(handle);
+        if (index == kNullBlock) return;
+
+        _blocks[index].generation = 0;
+        _used -= _blocks[index].size;
+        --_allocationCount;
+
+        // Coalesce with the physically following block
+        const u32 next = _blocks[index].nextPhysical;
+        if (next != kNullBlock && _blocks[next].free) {
+            RemoveFree(next);
+            _blocks[index].size += _blocks[next].size;
+            _blocks[index].nextPhysical = _blocks[next].nextPhysical;
+            if (_blocks[next].nextPhysical != kNullBlock) {
+                _blocks[_blocks[next].nextPhysical].prevPhysical = index;
+            }
+            ReleaseNode(next);
+        }
+
+        // Coalesce with the physically preceding block
+        const u32 prev = _blocks[index].prevPhysical;
+        if (prev != kNullBlock && _blocks[prev].free) {
+            RemoveFree(prev);
+            _blocks[prev].size += _blocks[index].size;
+            _blocks[prev].nextPhysical = _blocks[index].nextPhysical;
+            if (_blocks[index].nextPhysical != kNullBlock) {
+                _blocks[_blocks[index].nextPhysical].prevPhysical = prev;
+            }
+            ReleaseNode(index);
+            index = prev;
+        }
+
+        InsertFree(index);
+    }
+
+    vector<TlsfAllocator::Move> TlsfAllocator::Defragment() {
+        vector<Move> moves;
+        vector<u32> live;
+        live.reserve(_allocationCount);
+
+        for (u32 index = _firstBlock; index != kNullBlock;) {
+            const u32 next = _blocks[index].nextPhysical;
+            if (_blocks[index].free) {
+                ReleaseNode(index);
+            } else {
+                live.push_back(index);
+            }
+            index = next;
+        }
+
+        _firstLevelBitmap = 0;
+        _secondLevelBitmaps.fill(0);
+        for (auto& lists : _freeLists) {
+            lists.fill(kNullBlock);
+        }
+        _freeBlockCount = 0;
+        _firstBlock     = kNullBlock;
+
+        u32 cursor = 0;
+        u32 prev   = kNullBlock;
+        for (const u32 index : live) {
+            // The gap an aligned block leaves behind stays free. Blocks only ever move down, so
+            // the aligned cursor never passes the block's current offset.
+            const u32 alignment = _blocks[index].alignment;
+            const u32 aligned   = (cursor + alignment - 1) & ~(alignment - 1);
+            if (aligned != cursor) {
+                const u32 gap             = NewNode();
+                _blocks[gap].offset       = cursor;
+                _blocks[gap].size         = aligned - cursor;
+                _blocks[gap].prevPhysical = prev;
+                if (prev != kNullBlock) {
+                    _blocks[prev].nextPhysical = gap;
+                } else {
+                    _firstBlock = gap;
+                }
+                InsertFree(gap);
+                prev   = gap;
+                cursor = aligned;
+            }
+
+            auto& block = _blocks[index];
+            if (block.offset != cursor) {
+                moves.push_back({MakeHandle(index), block.offset, cursor, block.size});
+            }
+            block.offset       = cursor;
+            block.prevPhysical = prev;
+            block.nextPhysical = kNullBlock;
+            if (prev != kNullBlock) {
+                _blocks[prev].nextPhysical = index;
+            } else {
+                _firstBlock = index;
+            }
+            prev = index;
+            cursor += block.size;
+        }
+
+        if (cursor < _capacity) {
+            const u32 tail             = NewNode();
+            _blocks[tail].offset       = cursor;
+            _blocks[tail].size         = _capacity - cursor;
+            _blocks[tail].prevPhysical = prev;
+            if (prev != kNullBlock) {
+                _blocks[prev].nextPhysical = tail;
+            } else {
+                _firstBlock = tail;
+            }
+            InsertFree(tail);
+        }
+
+        return moves;
+    }
+
+    void TlsfAllocator::Reset() {
+        _blocks.clear();
+        _unusedNodes.clear();
+        _used             = 0;
+        _allocationCount  = 0;
+        _freeBlockCount   = 0;
+        _firstLevelBitmap = 0;
+        _secondLevelBitmaps.fill(0);
+        for (auto& lists : _freeLists) {
+            lists.fill(kNullBlock);
+        }
+
+        _firstBlock = kNullBlock;
+        if (_capacity == 0) return;
+
+        _firstBlock               = NewNode();
+        _blocks[_firstBlock].size = _capacity;
+        InsertFree(_firstBlock);
+    }
+
+    u32 TlsfAllocator::GetOffset(Handle handle) const {
+        const u32 index = Resolve(handle);
+        if (index == kNullBlock) {
+            Panic("Invalid or stale TLSF handle %llx", CAST<unsigned long long>(handle));
+        }
+        return _blocks[index].offset;
+    }
+
+    u32 TlsfAllocator::GetSize(Handle handle) const {
+        const u32 index = Resolve(handle);
+        if (index == kNullBlock) {
+            Panic("Invalid or stale TLSF handle %llx", CAST<unsigned long long>(handle));
+        }
+        return _blocks[index].size;
+    }
+
+    u32 TlsfAllocator::GetLargestFreeBlock() const {
+        if (_firstLevelBitmap == 0) return 0;
+        const u32 firstLevel  = 31 - std::countl_zero(_firstLevelBitmap);
+        const u32 secondLevel = 31 - std::countl_zero(_secondLevelBitmaps[firstLevel]);
+
+        u32 largest = 0;
+        u32 index   = _freeLists[firstLevel][secondLevel];
+        while (index != kNullBlock) {
+            largest = std::max(largest, _blocks[index].size);
+            index   = _blocks[index].nextFree;
+        }
+        return largest;
+    }
+
+    bool TlsfAllocator::Validate() const {
+        // Physical order: contiguous from 0 to capacity, links agree, free blocks coalesced
+        u32 expectedOffset = 0, prev = kNullBlock, used = 0, allocations = 0, freeBlocks = 0;
+        for (u32 index = _firstBlock; index != kNullBlock; index = _blocks[index].nextPhysical) {
+            const Block& block = _blocks[index];
+            if (block.offset != expectedOffset || block.size == 0) return false;
+            if (block.prevPhysical != prev) return false;
+            if (block.free) {
+                if (prev != kNullBlock && _blocks[prev].free) return false;
+                ++freeBlocks;
+            } else {
+                if (block.offset % block.alignment != 0) return false;
+                used += block.size;
+                ++allocations;
+            }
+            expectedOffset += block.size;
+            prev = index;
+        }
+        if (expectedOffset != _capacity || used != _used) return false;
+        if (allocations != _allocationCount || freeBlocks != _freeBlockCount) return false;
+
+        // Free lists: every listed block is free and in the list its size maps to, bitmaps
+        // mark exactly the non-empty lists, and no free block is missing
+        u32 listed = 0;
+        for (u32 firstLevel = 0; firstLevel < kFirstLevelCount; ++firstLevel) {
+            const bool firstSet = (_firstLevelBitmap >> firstLevel) & 1u;
+            if (firstSet != (_secondLevelBitmaps[firstLevel] != 0)) return false;
+            for (u32 secondLevel = 0; secondLevel < kSecondLevelCount; ++secondLevel) {
+                const u32 head      = _freeLists[firstLevel][secondLevel];
+                const bool bitSet   = (_secondLevelBitmaps[firstLevel] >> secondLevel) & 1u;
+                if (bitSet != (head != kNullBlock)) return false;
+
+                u32 prevFree = kNullBlock;
+                for (u32 index = head; index != kNullBlock; index = _blocks[index].nextFree) {
+                    const Block& block = _blocks[index];
+                    u32 blockFirst, blockSecond;
+                    Mapping(block.size, blockFirst, blockSecond);
+                    if (!block.free || block.prevFree != prevFree) return false;
+                    if (blockFirst != firstLevel || blockSecond != secondLevel) return false;
+                    if (++listed > freeBlocks) return false;  // Also catches cycles
+                    prevFree = index;
+                }
+            }
+        }
+        return listed == freeBlocks;
+    }
+
+    TlsfAllocator::Handle TlsfAllocator::MakeHandle(u32 index) const {
+        return (CAST<Handle>(_blocks[index].generation) << 32) | index;
+    }
+
+    // The node a handle names, or kNullBlock unless that node is still the live allocation
+    // the handle was returned for
+    u32 TlsfAllocator::Resolve(Handle handle) const {
+        const u32 index      = CAST<u32>(handle);
+        const u32 generation = CAST<u32>(handle >> 32);
+        if (generation == 0 || index >= _blocks.size()) return kNullBlock;
+
+        const Block& block = _blocks[index];
+        if (block.free || block.generation != generation) return kNullBlock;
+        return index;
+    }
+
+    u32 TlsfAllocator::NewNode() {
+        if (!_unusedNodes.empty()) {
+            const u32 index = _unusedNodes.back();
+            _unusedNodes.pop_back();
+            return index;
+        }
+        _blocks.emplace_back();
+        return CAST<u32>(_blocks.size() - 1);
+    }
+
+    void TlsfAllocator::ReleaseNode(u32 index) {
+        _blocks[index] = Block {};
+        _unusedNodes.push_back(index);
+    }
+
+    // Splits `index` after its first `size` units and returns the new block holding the rest.
+    // Neither block is put on a free list.
+    u32 TlsfAllocator::SplitAfter(u32 index, u32 size) {
+        const u32 remainder = NewNode();
+        auto& block         = _blocks[index];
+        auto& tail          = _blocks[remainder];
+        tail.offset         = block.offset + size;
+        tail.size           = block.size - size;
+        tail.prevPhysical   = index;
+        tail.nextPhysical   = block.nextPhysical;
+        if (block.nextPhysical != kNullBlock) {
+            _blocks[block.nextPhysical].prevPhysical = remainder;
+        }
+        block.nextPhysical = remainder;
+        block.size         = size;
+        return remainder;
+    }
+
+    void TlsfAllocator::InsertFree(u32 index) {
+        u32 firstLevel, secondLevel;
+        Mapping(_blocks[index].size, firstLevel, secondLevel);
+
+        auto& block    = _blocks[index];
+        const u32 head = _freeLists[firstLevel][secondLevel];
+        block.free     = true;
+        block.prevFree = kNullBlock;
+        block.nextFree = head;
+        if (head != kNullBlock) { _blocks[head].prevFree = index; }
+
+        _freeLists[firstLevel][secondLevel] = index;
+        _firstLevelBitmap |= 1u << firstLevel;
+        _secondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+        ++_freeBlockCount;
+    }
+
+    void TlsfAllocator::RemoveFree(u32 index) {
+        u32 firstLevel, secondLevel;
+        Mapping(_blocks[index].size, firstLevel, secondLevel);
+
+        auto& block = _blocks[index];
+        if (block.prevFree != kNullBlock) { _blocks[block.prevFree].nextFree = block.nextFree; }
+        if (block.nextFree != kNullBlock) { _blocks[block.nextFree].prevFree = block.prevFree; }
+
+        auto& head = _freeLists[firstLevel][secondLevel];
+        if (head == index) {
+            head = block.nextFree;
+            if (head == kNullBlock) {
+                _secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+                if (_secondLevelBitmaps[firstLevel] == 0) {
+                    _firstLevelBitmap &= ~(1u << firstLevel);
+                }
+            }
+        }
+
+        block.free     = false;
+        block.prevFree = kNullBlock;
+        block.nextFree = kNullBlock;
+        --_freeBlockCount;
+    }
+
+    u32 TlsfAllocator::FindFree(u32 size, u32& firstLevel, u32& secondLevel) const {
+        // Round up to the next second-level boundary so any block in the list found is
+        // guaranteed to be large enough (good-fit rather than a list walk)
+        u64 rounded = size;
+        if (size >= kSecondLevelCount) {
+            const u32 msb = std::bit_width(size) - 1;
+            rounded += (1ull << (msb - kSecondLevelBits)) - 1;
+        }
+        if (rounded <= 0xFFFFFFFFull) {
+            Mapping(CAST<u32>(rounded), firstLevel, secondLevel);
+            u32 secondLevelMap = _secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+            if (secondLevelMap == 0 && firstLevel + 1 < kFirstLevelCount) {
+                const u32 firstLevelMap = _firstLevelBitmap & (~0u << (firstLevel + 1));
+                if (firstLevelMap != 0) {
+                    firstLevel     = std::countr_zero(firstLevelMap);
+                    secondLevelMap = _secondLevelBitmaps[firstLevel];
+                }
+            }
+            if (secondLevelMap != 0) {
+                secondLevel = std::countr_zero(secondLevelMap);
+                return _freeLists[firstLevel][secondLevel];
+            }
+        }
+
+        // Nothing in the larger classes, but the request's own class can still hold a block
+        // that fits (say, the whole range when it is free), so walk it before failing
+        Mapping(size, firstLevel, secondLevel);
+        u32 index = _freeLists[firstLevel][secondLevel];
+        while (index != kNullBlock && _blocks[index].size < size) {
+            index = _blocks[index].nextFree;
+        }
+        return index;
+    }
+
+    void TlsfAllocator::Mapping(u32 size, u32& firstLevel, u32& secondLevel) {
+        if (size < kSecondLevelCount) {
+            firstLevel  = 0;
+            secondLevel = size;
+            return;
+        }
+        const u32 msb = std::bit_width(size) - 1;
+        firstLevel    = msb - kSecondLevelBits + 1;
+        secondLevel   = (size >> (msb - kSecondLevelBits)) - kSecondLevelCount;
+    }
+}  // namespace x
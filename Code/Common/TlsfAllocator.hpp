@@ -0,0 +1,120 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+namespace x {
+    // Two-Level Segregated Fit allocator over an abstract range of units (bytes, vertices,
+    // indices...). It only manages offsets, so it can back GPU heaps as easily as CPU memory.
+    // Allocation and free are O(1); handles stay valid across Defragment(). A handle pairs
+    // the block's node with the generation it was allocated under, so once freed it is
+    // rejected even after coalescing or a later allocation reuses the node.
+    class TlsfAllocator {
+    public:
+        using Handle                           = u64;
+        static constexpr Handle kInvalidHandle = ~0ull;
+
+        struct Move {
+            Handle handle;
+            u32 srcOffset;
+            u32 dstOffset;
+            u32 size;
+        };
+
+        explicit TlsfAllocator(u32 capacity);
+
+        // `alignment` applies to the returned offset and must be a power of two. Padding in
+        // front of an aligned block stays free.
+        Handle Allocate(u32 size, u32 alignment = 1);
+
+        // Ignores invalid, stale and already freed handles.
+        void Free(Handle handle);
+
+        // Compacts all live allocations towards offset 0, keeping each one's alignment. The
+        // returned moves are sorted by destination and never overlap a later source, so they
+        // can be applied in order.
+        vector<Move> Defragment();
+
+        void Reset();
+
+        // True while `handle` refers to a live allocation of this allocator.
+        bool IsValid(Handle handle) const {
+            return Resolve(handle) != kNullBlock;
+        }
+
+        // Both panic on a handle that isn't valid.
+        u32 GetOffset(Handle handle) const;
+        u32 GetSize(Handle handle) const;
+
+        u32 GetCapacity() const {
+            return _capacity;
+        }
+
+        u32 GetUsed() const {
+            return _used;
+        }
+
+        u32 GetAllocationCount() const {
+            return _allocationCount;
+        }
+
+        u32 GetFreeBlockCount() const {
+            return _freeBlockCount;
+        }
+
+        u32 GetLargestFreeBlock() const;
+
+        // Walks every block and free list and checks the bookkeeping agrees: blocks tile the
+        // whole range, no two free blocks are adjacent, and each free block is listed exactly
+        // once under the bitmaps for its size. O(blocks); meant for tests and debugging.
+        bool Validate() const;
+
+    private:
+        static constexpr u32 kSecondLevelBits  = 4;
+        static constexpr u32 kSecondLevelCount = 1u << kSecondLevelBits;
+        static constexpr u32 kFirstLevelCount  = 32;
+        static constexpr u32 kNullBlock        = ~0u;
+
+        struct Block {
+            u32 offset       = 0;
+            u32 size         = 0;
+            u32 prevPhysical = kNullBlock;
+            u32 nextPhysical = kNullBlock;
+            u32 prevFree     = kNullBlock;
+            u32 nextFree     = kNullBlock;
+            u32 alignment    = 1;  // Of a live block, kept through Defragment()
+            u32 generation   = 0;  // Of a live block, 0 otherwise
+            bool free        = false;
+        };
+
+        u32 _capacity;
+        u32 _used            = 0;
+        u32 _allocationCount = 0;
+        u32 _freeBlockCount  = 0;
+        u32 _firstBlock      = kNullBlock;
+        u32 _generation      = 0;  // Not reset by Reset(), so older handles stay stale
+
+        vector<Block> _blocks;
+        vector<u32> _unusedNodes;
+
+        u32 _firstLevelBitmap = 0;
+        array<u32, kFirstLevelCount> _secondLevelBitmaps {};
+        array<array<u32, kSecondLevelCount>, kFirstLevelCount> _freeLists {};
+
+        Handle MakeHandle(u32 index) const;
+        u32 Resolve(Handle handle) const;
+
+        u32 NewNode();
+        void ReleaseNode(u32 index);
+
+        u32 SplitAfter(u32 index, u32 size);
+        void InsertFree(u32 index);
+        void RemoveFree(u32 index);
+        u32 FindFree(u32 size, u32& firstLevel, u32& secondLevel) const;
+
+        static void Mapping(u32 size, u32& firstLevel, u32& secondLevel);
+    };
+}  // namespace x
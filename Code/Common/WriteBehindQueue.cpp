@@ -0,0 +1,274 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "WriteBehindQueue.hpp"
+#include "MetadataCache.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <unordered_set>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace x::Filesystem {
+    namespace {
+        // Minimal unbuffered file handle; ofstream can't fsync.
+        class OutputFile {
+        public:
+            OutputFile(const str& path, bool create) {
+#ifdef _WIN32
+                const HANDLE file = CreateFileA(path.c_str(),
+                                                GENERIC_WRITE,
+                                                0,
+                                                None,
+                                                create ? CREATE_ALWAYS : OPEN_EXISTING,
+                                                FILE_ATTRIBUTE_NORMAL,
+                                                None);
+                _file             = file == INVALID_HANDLE_VALUE ? None : file;
+#else
+                const int flags = O_WRONLY | O_CLOEXEC | (create ? O_CREAT | O_TRUNC : 0);
+                _fd             = open(path.c_str(), flags, 0644);
+#endif
+            }
+
+            ~OutputFile() {
+#ifdef _WIN32
+                if (_file) { CloseHandle(_file); }
+#else
+                if (_fd >= 0) { close(_fd); }
+#endif
+            }
+
+            OutputFile(const OutputFile&)            = delete;
+            OutputFile& operator=(const OutputFile&) = delete;
+
+            bool IsOpen() const {
+#ifdef _WIN32
+                return _file != None;
+#else
+                return _fd >= 0;
+#endif
+            }
+
+            bool WriteAt(const u8* data, size_t size, u64 offset) const {
+                while (size > 0) {
+#ifdef _WIN32
+                    OVERLAPPED overlapped {};
+                    overlapped.Offset     = CAST<DWORD>(offset);
+                    overlapped.OffsetHigh = CAST<DWORD>(offset >> 32);
+                    DWORD written         = 0;
+                    const auto chunk      = CAST<DWORD>(std::min<size_t>(size, 1u << 30));
+                    if (!WriteFile(_file, data, chunk, &written, &overlapped)) { return false; }
+#else
+                    const ssize_t written = pwrite(_fd, data, size, CAST<off_t>(offset));
+                    if (written < 0) {
+                        if (errno == EINTR) { continue; }
+                        return false;
+                    }
+#endif
+                    data += written;
+                    size -= CAST<size_t>(written);
+                    offset += CAST<u64>(written);
+                }
+                return true;
+            }
+
+            bool Sync() const {
+#ifdef _WIN32
+                return FlushFileBuffers(_file) != 0;
+#else
+                return fsync(_fd) == 0;
+#endif
+            }
+
+        private:
+#ifdef _WIN32
+            void* _file = None;
+#else
+            int _fd = -1;
+#endif
+        };
+
+        bool ReplaceFile(const str& from, const str& to) {
+#ifdef _WIN32
+            return MoveFileExA(from.c_str(),
+                               to.c_str(),
+                               MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+            return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+        }
+
+        std::span<const u8> AsBytes(const std::variant<vector<u8>, str>& payload) {
+            return std::visit(
+              [](const auto& buffer) {
+                  return std::span<const u8>(RCAST<const u8*>(buffer.data()), buffer.size());
+              },
+              payload);
+        }
+    }  // namespace
+
+    WriteBehindQueue::WriteBehindQueue(const WriteBehindOptions& options)
+        : _options(options), _thread([this]() { WriterLoop(); }) {}
+
+    WriteBehindQueue::~WriteBehindQueue() {
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _wake.notify_one();
+        _thread.join();
+    }
+
+    std::future<bool> WriteBehindQueue::Write(const Path& path, vector<u8>&& data) {
+        Payload contents(std::move(data));
+        return Enqueue(path, &contents, None);
+    }
+
+    std::future<bool> WriteBehindQueue::Write(const Path& path, str&& text) {
+        Payload contents(std::move(text));
+        return Enqueue(path, &contents, None);
+    }
+
+    std::future<bool>
+    WriteBehindQueue::WriteBlock(const Path& path, vector<u8>&& data, u64 offset) {
+        Block block {offset, std::move(data)};
+        return Enqueue(path, None, &block);
+    }
+
+    void WriteBehindQueue::Flush() {
+        std::unique_lock lock(_mutex);
+        const u64 ticket = ++_flushRequested;
+        _wake.notify_one();
+        _committed.wait(lock, [&]() { return _flushCompleted >= ticket; });
+    }
+
+    size_t WriteBehindQueue::GetPendingCount() const {
+        std::lock_guard lock(_mutex);
+        return _pending.size();
+    }
+
+    std::future<bool> WriteBehindQueue::Enqueue(const Path& path, Payload* contents, Block* block) {
+        std::promise<bool> promise;
+        auto future = promise.get_future();
+        {
+            std::lock_guard lock(_mutex);
+            PendingWrite& write = _pending[path.Str()];
+            if (contents) {
+                write.contents = std::move(*contents);
+                write.blocks.clear();
+            } else if (write.contents) {
+                // Fold the block into the pending contents rather than touching the file twice
+                std::visit(
+                  [block](auto& buffer) {
+                      const size_t end = CAST<size_t>(block->offset) + block->data.size();
+                      if (buffer.size() < end) { buffer.resize(end); }
+                      if (block->data.empty()) { return; }
+                      memcpy(buffer.data() + block->offset, block->data.data(), block->data.size());
+                  },
+                  *write.contents);
+            } else {
+                write.blocks.push_back(std::move(*block));
+            }
+            write.waiters.push_back(std::move(promise));
+        }
+        _wake.notify_one();
+        return future;
+    }
+
+    void WriteBehindQueue::WriterLoop() {
+        std::unique_lock lock(_mutex);
+        for (;;) {
+            const auto flushPending = [this]() { return _flushRequested > _flushCompleted; };
+            _wake.wait(lock, [&]() { return _stopping || !_pending.empty() || flushPending(); });
+            if (_stopping && _pending.empty()) { break; }
+
+            // Let writes accumulate for the interval unless someone is waiting on them
+            if (!_stopping && !flushPending()) {
+                _wake.wait_for(lock, _options.flushInterval, [&]() {
+                    return _stopping || flushPending();
+                });
+            }
+
+            const u64 flushTarget = _flushRequested;
+            auto batch            = std::move(_pending);
+            _pending.clear();
+            lock.unlock();
+
+            vector<str> replaced;
+            for (auto& [path, write] : batch) {
+                const bool ok = Commit(path, write);
+                MetadataCache::Global().Invalidate(path);
+                if (ok && write.contents && _options.atomicCommit) { replaced.push_back(path); }
+                for (auto& waiter : write.waiters) {
+                    waiter.set_value(ok);
+                }
+            }
+            if (_options.syncToDisk && !replaced.empty()) { SyncDirectories(replaced); }
+
+            lock.lock();
+            _flushCompleted = flushTarget;
+            _committed.notify_all();
+        }
+    }
+
+    bool WriteBehindQueue::Commit(const str& path, PendingWrite& write) const {
+        if (!write.contents) {
+            const OutputFile file(path, false);
+            if (!file.IsOpen()) { return false; }
+            for (const auto& block : write.blocks) {
+                if (!file.WriteAt(block.data.data(), block.data.size(), block.offset)) {
+                    return false;
+                }
+            }
+            return !_options.syncToDisk || file.Sync();
+        }
+
+        static std::atomic<u32> tempCounter {0};
+        const str target = _options.atomicCommit
+                             ? path + "." + std::to_string(tempCounter.fetch_add(1)) + ".tmp"
+                             : path;
+        bool ok = false;
+        {
+            const OutputFile file(target, true);
+            const auto bytes = AsBytes(*write.contents);
+
+            ok = file.IsOpen() && file.WriteAt(bytes.data(), bytes.size(), 0) &&
+                 (!_options.syncToDisk || file.Sync());
+        }
+        if (!_options.atomicCommit) { return ok; }
+        if (!ok || !ReplaceFile(target, path)) {
+            std::remove(target.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void WriteBehindQueue::SyncDirectories(const vector<str>& paths) const {
+#ifdef _WIN32
+        // MOVEFILE_WRITE_THROUGH already waited for each rename to reach the disk
+        std::ignore = paths;
+#else
+        // A rename is only durable once the directory entry is, so sync each parent once
+        std::unordered_set<str> directories;
+        for (const auto& path : paths) {
+            directories.insert(Path(path).Parent().Str());
+        }
+        for (const auto& directory : directories) {
+            const int fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+            if (fd < 0) { continue; }
+            fsync(fd);
+            close(fd);
+        }
+#endif
+    }
+}  // namespace x::Filesystem
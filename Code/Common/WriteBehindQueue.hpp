@@ -0,0 +1,83 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <variant>
+
+namespace x::Filesystem {
+    struct WriteBehindOptions {
+        // How long writes sit in the queue before a batch commits them. Writes to the same
+        // file within one interval coalesce into a single open/write/sync. Zero commits as
+        // soon as the writer thread wakes.
+        std::chrono::milliseconds flushInterval {250};
+        // Whole-file writes go to a temporary file that is renamed over the target, so a
+        // crash leaves either the old or the new contents.
+        bool atomicCommit = true;
+        // fsync each file (and, after renames, its directory) once per batch.
+        bool syncToDisk = true;
+    };
+
+    // Background writer for saves and other fire-and-forget output. Payloads are moved in,
+    // never copied. A later whole-file write to a path replaces a pending one, and block writes
+    // are applied on top of a pending whole-file write in memory. Each returned future resolves
+    // once the batch containing that write (or the write that superseded it) is committed.
+    // Block writes update the file in place and are not atomic.
+    class WriteBehindQueue {
+    public:
+        explicit WriteBehindQueue(const WriteBehindOptions& options = WriteBehindOptions());
+        ~WriteBehindQueue();
+
+        WriteBehindQueue(const WriteBehindQueue&)            = delete;
+        WriteBehindQueue& operator=(const WriteBehindQueue&) = delete;
+
+        std::future<bool> Write(const Path& path, vector<u8>&& data);
+        // Text is written verbatim, without newline translation.
+        std::future<bool> Write(const Path& path, str&& text);
+        // Like FileWriter::WriteBlock, fails if the file doesn't exist and nothing is pending.
+        std::future<bool> WriteBlock(const Path& path, vector<u8>&& data, u64 offset);
+
+        // Commits everything queued so far and waits for it.
+        void Flush();
+
+        size_t GetPendingCount() const;
+
+    private:
+        using Payload = std::variant<vector<u8>, str>;
+
+        struct Block {
+            u64 offset;
+            vector<u8> data;
+        };
+
+        struct PendingWrite {
+            std::optional<Payload> contents;
+            vector<Block> blocks;
+            vector<std::promise<bool>> waiters;
+        };
+
+        WriteBehindOptions _options;
+        unordered_map<str, PendingWrite> _pending;
+        mutable std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _committed;
+        u64 _flushRequested = 0;
+        u64 _flushCompleted = 0;
+        bool _stopping      = false;
+        // Last, so everything the writer touches is initialized before it starts
+        std::thread _thread;
+
+        std::future<bool> Enqueue(const Path& path, Payload* contents, Block* block);
+        void WriterLoop();
+        bool Commit(const str& path, PendingWrite& write) const;
+        void SyncDirectories(const vector<str>& paths) const;
+    };
+}  // namespace x::Filesystem
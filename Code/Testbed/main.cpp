@@ -7,7 +7,9 @@ int main() {
     dx::DxGraphicsDevice device;
     auto buff =
       device.CreateBuffer({64, D3D11_USAGE_DEFAULT, D3D11_BIND_CONSTANT_BUFFER, 0, 0, 0, None});
-    buff->BindAsConstantBuffer(0, dx::ShaderStages::Vertex | dx::ShaderStages::Pixel);
+    buff->BindAsConstantBuffer(device.GetImmediateContext(),
+                               0,
+                               ShaderStages::Vertex | ShaderStages::Pixel);
 
     return 0;
 }
\ No newline at end of file
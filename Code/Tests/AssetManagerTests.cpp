@@ -0,0 +1,190 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "AssetManager.hpp"
+#include "Assets.hpp"
+#include "Null/NullGraphicsDevice.hpp"
+
+#include <cstring>
+#include <filesystem>
+
+using namespace x;
+using namespace x::null;
+
+namespace {
+    constexpr u32 kVertexStride = 16;
+
+    Filesystem::Path AssetPath(const char* name) {
+        const auto directory = std::filesystem::temp_directory_path() / "xtests_assets";
+        std::filesystem::create_directories(directory);
+        return Filesystem::Path((directory / name).string());
+    }
+
+    // A non-indexed mesh whose vertex data is `vertexCount * kVertexStride` bytes
+    Filesystem::Path WriteMesh(const char* name, u32 vertexCount) {
+        const MeshFileHeader header {kMeshMagic, kMeshVersion, kVertexStride, vertexCount, 0, 0};
+        vector<u8> bytes(sizeof(header) + vertexCount * kVertexStride, 0xAB);
+        memcpy(bytes.data(), &header, sizeof(header));
+        const auto path = AssetPath(name);
+        Filesystem::FileWriter::WriteAllBytes(path, bytes);
+        return path;
+    }
+
+    // A valid DDS header with an empty data section, so the texture reports 0 bytes
+    Filesystem::Path WriteEmptyTexture(const char* name) {
+        vector<u8> bytes(128, 0);
+        const u32 fields[] = {0x20534444, 124, 0, 4, 4};  // Magic, size, flags, height, width
+        memcpy(bytes.data(), fields, sizeof(fields));
+        const u32 pixelFormat[] = {32, 0x4, 0x31545844};  // Size, FourCC flag, "DXT1"
+        memcpy(bytes.data() + 4 + 72, pixelFormat, sizeof(pixelFormat));
+        const auto path = AssetPath(name);
+        Filesystem::FileWriter::WriteAllBytes(path, bytes);
+        return path;
+    }
+
+    Filesystem::Path WriteScene(const char* name, const str& text) {
+        const auto path = AssetPath(name);
+        Filesystem::FileWriter::WriteAllText(path, text);
+        return path;
+    }
+
+    AssetManagerOptions WithBudget(size_t bytes) {
+        AssetManagerOptions options;
+        options.memoryBudget = bytes;
+        return options;
+    }
+}  // namespace
+
+X_TEST(AssetManager, LoadsEachPathOnce) {
+    NullGraphicsDevice device;
+    ThreadPool pool(2);
+    AssetManager manager(pool);
+    RegisterBuiltinAssetLoaders(manager, device);
+
+    const auto path = WriteMesh("Dedup.xmesh", 4);
+    const auto first  = manager.Load<MeshAsset>(path);
+    const auto second = manager.Load<MeshAsset>(path);
+    X_CHECK(first.GetId() == second.GetId());
+    X_REQUIRE(first.Wait() == AssetState::Ready && second.IsReady());
+    X_CHECK(first.Get() == second.Get());
+    X_CHECK(first->vertexCount == 4 && first->vertexBuffer->GetSize() == 4 * kVertexStride);
+    X_CHECK(device.GetBufferCount() == 1);
+
+    const AssetStats stats = manager.GetStats();
+    X_CHECK(stats.loads == 1 && stats.hits == 1 && stats.resident == 1);
+    X_CHECK(stats.memoryUsed == 4 * kVertexStride);
+}
+
+X_TEST(AssetManager, EvictsLeastRecentlyReleasedOverBudget) {
+    NullGraphicsDevice device;
+    ThreadPool pool(2);
+    AssetManager manager(pool, WithBudget(128));
+    RegisterBuiltinAssetLoaders(manager, device);
+
+    // 64 bytes each; referenced assets stay resident even over the budget
+    auto a = manager.Load<MeshAsset>(WriteMesh("BudgetA.xmesh", 4));
+    auto b = manager.Load<MeshAsset>(WriteMesh("BudgetB.xmesh", 4));
+    auto c = manager.Load<MeshAsset>(WriteMesh("BudgetC.xmesh", 4));
+    manager.WaitIdle();
+    X_CHECK(manager.GetStats().memoryUsed == 192 && manager.GetStats().evictions == 0);
+
+    const AssetId aId = a.GetId();
+    const AssetId bId = b.GetId();
+    a.Reset();  // Over budget, so it goes straight away
+    b.Reset();  // Back within budget, so it stays cached
+    AssetStats stats = manager.GetStats();
+    X_CHECK(stats.evictions == 1 && stats.resident == 2 && stats.unreferenced == 1);
+    X_CHECK(!manager.Lock<MeshAsset>(aId).IsValid());
+
+    auto relocked = manager.Lock<MeshAsset>(bId);
+    X_REQUIRE(relocked.IsReady());
+    manager.SetMemoryBudget(64);
+    X_CHECK(manager.GetStats().memoryUsed == 128);
+
+    relocked.Reset();
+    c.Reset();
+    stats = manager.GetStats();
+    X_CHECK(stats.evictions == 2 && stats.resident == 1 && stats.memoryUsed == 64);
+    X_CHECK(!manager.Lock<MeshAsset>(bId).IsValid());
+}
+
+X_TEST(AssetManager, FailedDependencyFailsTheDependent) {
+    NullGraphicsDevice device;
+    ThreadPool pool(2);
+    AssetManager manager(pool);
+    RegisterBuiltinAssetLoaders(manager, device);
+
+    WriteMesh("Good.xmesh", 2);
+    const auto scenePath = WriteScene("Broken.xscene", "mesh Good.xmesh\ntexture Missing.dds\n");
+    auto scene           = manager.Load<SceneAsset>(scenePath);
+    X_CHECK(scene.Wait() == AssetState::Failed);
+    X_CHECK(scene.Get() == None);
+
+    // The healthy dependency still loads, and is released along with the failed scene
+    auto mesh = manager.Load<MeshAsset>(AssetPath("Good.xmesh"));
+    X_CHECK(mesh.Wait() == AssetState::Ready);
+    X_CHECK(manager.GetStats().failed >= 1);
+
+    // Dropping a failed asset forgets it, so the next request tries again
+    scene.Reset();
+    manager.WaitIdle();
+    const u64 loads = manager.GetStats().loads;
+    WriteEmptyTexture("Missing.dds");
+    scene = manager.Load<SceneAsset>(scenePath);
+    X_CHECK(scene.Wait() == AssetState::Ready);
+    X_CHECK(manager.GetStats().loads > loads);
+    X_CHECK(scene->meshes.size() == 1 && scene->textures.size() == 1);
+    std::filesystem::remove(AssetPath("Missing.dds").Str());
+}
+
+X_TEST(AssetManager, TrimEvictsZeroByteAssetsAndTheirDependencies) {
+    NullGraphicsDevice device;
+    ThreadPool pool(2);
+    AssetManager manager(pool);
+    RegisterBuiltinAssetLoaders(manager, device);
+
+    auto texture = manager.Load<TextureAsset>(WriteEmptyTexture("Empty.dds"));
+    X_REQUIRE(texture.Wait() == AssetState::Ready);
+    X_CHECK(texture->data.empty() && manager.GetStats().memoryUsed == 0);
+
+    WriteMesh("Child.xmesh", 2);
+    auto scene = manager.Load<SceneAsset>(
+      WriteScene("Parent.xscene", "mesh Child.xmesh\ntexture Empty.dds\n"));
+    X_REQUIRE(scene.Wait() == AssetState::Ready);
+
+    texture.Reset();
+    scene.Reset();
+    X_CHECK(manager.GetStats().unreferenced == 1);  // The scene; its dependencies are held
+
+    manager.Trim();
+    const AssetStats stats = manager.GetStats();
+    X_CHECK(stats.resident == 0 && stats.unreferenced == 0 && stats.memoryUsed == 0);
+    X_CHECK(stats.evictions == 3);
+}
+
+X_TEST(AssetManager, TeardownDestroysEverythingThroughTheReleaseQueue) {
+    NullGraphicsDevice device;
+    ThreadPool pool(2);
+    DeferredReleaseQueue queue;
+    weak_ptr<GraphicsBuffer> vertices;
+    {
+        AssetManagerOptions options;
+        options.releaseQueue = &queue;
+        AssetManager manager(pool, options);
+        RegisterBuiltinAssetLoaders(manager, device);
+
+        WriteMesh("Teardown.xmesh", 8);
+        WriteEmptyTexture("Teardown.dds");
+        auto scene = manager.Load<SceneAsset>(
+          WriteScene("Teardown.xscene", "mesh Teardown.xmesh\ntexture Teardown.dds\n"));
+        X_REQUIRE(scene.Wait() == AssetState::Ready);
+        vertices = scene->meshes[0]->vertexBuffer;
+
+        // Unreferenced but cached, including a 0-byte texture, when the manager goes away
+        scene.Reset();
+        X_CHECK(manager.GetStats().resident == 3);
+    }
+    X_CHECK(vertices.expired());
+}
@@ -0,0 +1,42 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "LineScanner.hpp"
+
+#include <cstdio>
+#include <filesystem>
+
+using namespace x;
+using namespace x::Filesystem;
+
+X_TEST(LineScanner, StripsOneTrailingCarriageReturn) {
+    LineScanner scanner("a\r\nb\rc\r\r\n\nlast");
+    vector<std::string_view> lines;
+    scanner.ForEach([&](std::string_view line) { lines.push_back(line); });
+    X_REQUIRE(lines.size() == 4);
+    X_CHECK(lines[0] == "a");
+    X_CHECK(lines[1] == "b\rc\r");
+    X_CHECK(lines[2].empty());
+    X_CHECK(lines[3] == "last");
+}
+
+X_TEST(LineScanner, MatchesReadAllLines) {
+    const auto path = (std::filesystem::temp_directory_path() / "xtests_lines.txt").string();
+    const char text[] = "first\r\nsecond\nthird\r\n\r\nwith\rcarriage return\r\nlast\n";
+    FILE* file        = fopen(path.c_str(), "wb");
+    X_REQUIRE(file != None);
+    fwrite(text, 1, sizeof(text) - 1, file);
+    fclose(file);
+
+    const vector<str> expected = FileReader::ReadAllLines(Path(path));
+    LineScanner scanner(std::string_view(text, sizeof(text) - 1));
+    size_t index = 0;
+    scanner.ForEach([&](std::string_view line) {
+        X_CHECK(index < expected.size() && line == expected[index]);
+        ++index;
+    });
+    X_CHECK(index == expected.size());
+    std::remove(path.c_str());
+}
@@ -0,0 +1,127 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "Null/NullGraphicsDevice.hpp"
+
+#include <cstring>
+
+using namespace x;
+using namespace x::null;
+
+X_TEST(NullGraphicsDevice, CountsBuffersAndUploadedBytes) {
+    NullGraphicsDevice device;
+    const u8 initial[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    const auto vertices = device.CreateVertexBuffer(initial, sizeof(initial));
+    const auto dynamic  = device.CreateVertexBuffer(None, 64, true);
+    const auto indices  = device.CreateIndexBuffer(None, 32);
+    X_CHECK(device.GetBufferCount() == 3);
+    X_CHECK(device.GetBufferBytes() == 104);
+    X_CHECK(vertices->GetSize() == 8 && !vertices->IsDynamic() && dynamic->IsDynamic());
+    X_CHECK(memcmp(CAST<NullBuffer&>(*vertices).GetData().data(), initial, 8) == 0);
+
+    auto& context    = device.GetImmediateContext();
+    const u32 data[] = {0xAAAAAAAA, 0xBBBBBBBB};
+    context.UpdateBuffer(*dynamic, data, sizeof(data));
+    context.UpdateBufferRange(*indices, data, 4, 16, false);
+    const NullStats& stats = device.GetFrameStats();
+    X_CHECK(stats.uploads == 2 && stats.bytesUploaded == 12);
+
+    // Contents are visible as soon as the update is recorded
+    const auto& written = CAST<NullBuffer&>(*indices).GetData();
+    X_CHECK(memcmp(written.data() + 16, data, 4) == 0);
+    X_CHECK(vertices->SupportsBinding(BufferBindings::Vertex));
+    X_CHECK(!vertices->SupportsBinding(BufferBindings::Index));
+}
+
+X_TEST(NullGraphicsDevice, RecordsEveryCommandInOrder) {
+    NullGraphicsDevice device;
+    const auto vertices  = device.CreateVertexBuffer(None, 256);
+    const auto indices   = device.CreateIndexBuffer(None, 128);
+    const auto constants = device.CreateConstantBuffer(64);
+    const u8 bytecode[4] = {0xDE, 0xAD, 0xBE, 0xEF};
+    const auto shader    = device.CreateShader(ShaderStages::Pixel, bytecode, sizeof(bytecode));
+
+    auto& context = device.GetImmediateContext();
+    context.BindVertexBuffer(1, *vertices, 32, 64);
+    context.BindIndexBuffer(*indices, IndexFormat::U32, 8);
+    context.BindConstantBuffer(2, ShaderStages::Vertex | ShaderStages::Pixel, *constants);
+    context.BindShader(*shader);
+    context.Draw(3, 6);
+    context.DrawIndexed(36, 12, -4);
+    context.DrawIndexedInstanced(36, 10, 72, 100, 5);
+
+    const auto& commands = context.GetCommands();
+    X_REQUIRE(commands.size() == 7);
+    X_CHECK(commands[0].type == NullCommandType::BindVertexBuffer);
+    X_CHECK(commands[0].resource == vertices.get());
+    X_CHECK(commands[0].args[0] == 1 && commands[0].args[1] == 32 && commands[0].args[2] == 64);
+    X_CHECK(commands[1].type == NullCommandType::BindIndexBuffer);
+    X_CHECK(commands[1].args[0] == CAST<u32>(IndexFormat::U32) && commands[1].args[1] == 8);
+    X_CHECK(commands[2].type == NullCommandType::BindConstantBuffer);
+    X_CHECK(commands[2].resource == constants.get() && commands[2].args[0] == 2);
+    X_CHECK(commands[3].type == NullCommandType::BindShader);
+    X_CHECK(commands[3].resource == shader.get());
+    X_CHECK(commands[3].args[0] == CAST<u32>(ShaderStages::Pixel));
+    X_CHECK(commands[4].type == NullCommandType::Draw && commands[4].resource == None);
+    X_CHECK(commands[4].args[0] == 3 && commands[4].args[1] == 6);
+    X_CHECK(commands[5].type == NullCommandType::DrawIndexed);
+    X_CHECK(CAST<i32>(commands[5].args[2]) == -4);
+    X_CHECK(commands[6].type == NullCommandType::DrawIndexedInstanced);
+    X_CHECK(commands[6].args[1] == 10 && commands[6].args[2] == 72);
+    X_CHECK(commands[6].args[3] == 100 && commands[6].args[4] == 5);
+
+    const NullStats& stats = device.GetFrameStats();
+    X_CHECK(stats.binds == 4 && stats.draws == 3 && stats.instances == 12);
+    X_CHECK(CAST<NullShader&>(*shader).GetBytecode().size() == sizeof(bytecode));
+}
+
+X_TEST(NullGraphicsDevice, BeginFrameKeepsTheLastFramesStats) {
+    NullGraphicsDevice device;
+    auto& context = device.GetImmediateContext();
+    context.Draw(3, 0);
+    context.Draw(3, 3);
+
+    device.BeginFrame();
+    X_CHECK(device.GetLastFrameStats().draws == 2);
+    X_CHECK(device.GetFrameStats().draws == 0);
+    X_CHECK(context.GetCommands().empty());
+
+    device.BeginFrame();
+    X_CHECK(device.GetLastFrameStats().draws == 0);
+}
+
+X_TEST(NullGraphicsDevice, DeferredListsMergeIntoTheImmediateContext) {
+    NullGraphicsDevice device;
+    const auto dynamic = device.CreateVertexBuffer(None, 64, true);
+    auto deferred      = device.CreateCommandContext();
+    X_REQUIRE(CAST<NullCommandContext&>(*deferred).IsDeferred());
+
+    const u32 data = 7;
+    deferred->UpdateBuffer(*dynamic, &data, sizeof(data));
+    deferred->BindVertexBuffer(0, *dynamic, 4, 0);
+    deferred->Draw(1, 0);
+    auto list = deferred->Finish();
+
+    // Finishing hands the recording to the list and leaves the context empty
+    const auto& recorded = CAST<NullCommandContext&>(*deferred);
+    X_CHECK(recorded.GetCommands().empty() && recorded.GetStats().draws == 0);
+    X_CHECK(device.GetImmediateContext().GetCommands().empty());
+
+    auto& immediate = device.GetImmediateContext();
+    immediate.Draw(4, 0);
+    immediate.Execute(*list);
+    immediate.Execute(*list);
+
+    const auto& commands = immediate.GetCommands();
+    X_REQUIRE(commands.size() == 7);
+    X_CHECK(commands[0].type == NullCommandType::Draw && commands[0].args[0] == 4);
+    X_CHECK(commands[1].type == NullCommandType::UpdateBuffer);
+    X_CHECK(commands[4].type == NullCommandType::UpdateBuffer);
+    X_CHECK(commands[6].type == NullCommandType::Draw && commands[6].args[0] == 1);
+
+    const NullStats& stats = device.GetFrameStats();
+    X_CHECK(stats.draws == 3 && stats.binds == 2);
+    X_CHECK(stats.uploads == 2 && stats.bytesUploaded == 2 * sizeof(data));
+}
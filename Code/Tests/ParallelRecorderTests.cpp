@@ -0,0 +1,99 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "ParallelRecorder.hpp"
+#include "Null/NullGraphicsDevice.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace x;
+using namespace x::null;
+
+namespace {
+    constexpr u32 kJobCount    = 12;
+    constexpr u32 kDrawsPerJob = 5;
+
+    // Each job's draws carry the job and draw number, so the merged stream shows exactly
+    // where every command came from. Earlier jobs sleep longer, so they finish recording last.
+    void RecordJob(CommandContext& context, GraphicsBuffer& vertices, u32 job) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(kJobCount - job));
+        context.BindVertexBuffer(0, vertices, 16, job);
+        for (u32 draw = 0; draw < kDrawsPerJob; ++draw) {
+            context.Draw(job, draw);
+        }
+    }
+
+    bool IsInJobOrder(const vector<NullCommand>& commands, GraphicsBuffer& vertices) {
+        if (commands.size() != kJobCount * (kDrawsPerJob + 1)) { return false; }
+        size_t index = 0;
+        for (u32 job = 0; job < kJobCount; ++job) {
+            const auto& bind = commands[index++];
+            if (bind.type != NullCommandType::BindVertexBuffer) { return false; }
+            if (bind.resource != &vertices || bind.args[2] != job) { return false; }
+            for (u32 draw = 0; draw < kDrawsPerJob; ++draw) {
+                const auto& command = commands[index++];
+                if (command.type != NullCommandType::Draw) { return false; }
+                if (command.args[0] != job || command.args[1] != draw) { return false; }
+            }
+        }
+        return true;
+    }
+}  // namespace
+
+X_TEST(ParallelRecorder, ExecutesListsInSubmissionOrder) {
+    NullGraphicsDevice device;
+    GraphicsRecordingBackend backend(device);
+    ThreadPool pool(4);
+    ParallelRecorder<GraphicsRecordingBackend> recorder(backend, pool);
+    const auto vertices = device.CreateVertexBuffer(None, 256);
+
+    for (u32 job = 0; job < kJobCount; ++job) {
+        recorder.Add([&, job](CommandContext& context) { RecordJob(context, *vertices, job); });
+    }
+    X_CHECK(recorder.GetPendingJobCount() == kJobCount);
+    recorder.Execute();
+    X_CHECK(recorder.GetPendingJobCount() == 0);
+
+    X_CHECK(IsInJobOrder(device.GetImmediateContext().GetCommands(), *vertices));
+    const NullStats& stats = device.GetFrameStats();
+    X_CHECK(stats.binds == kJobCount);
+    X_CHECK(stats.draws == kJobCount * kDrawsPerJob);
+}
+
+X_TEST(ParallelRecorder, ReusedContextsStartEmpty) {
+    NullGraphicsDevice device;
+    GraphicsRecordingBackend backend(device);
+    ThreadPool pool(3);
+    ParallelRecorder<GraphicsRecordingBackend> recorder(backend, pool);
+    const auto vertices = device.CreateVertexBuffer(None, 256);
+
+    // A later frame with fewer jobs reuses the first frame's contexts; nothing recorded in
+    // the first frame may leak into the second
+    for (u32 frame = 0; frame < 3; ++frame) {
+        device.BeginFrame();
+        const u32 jobs = frame == 1 ? kJobCount / 2 : kJobCount;
+        for (u32 job = 0; job < jobs; ++job) {
+            recorder.Add([&, job](CommandContext& context) {
+                RecordJob(context, *vertices, job);
+            });
+        }
+        recorder.Execute();
+
+        const auto& commands = device.GetImmediateContext().GetCommands();
+        X_CHECK(commands.size() == jobs * (kDrawsPerJob + 1));
+        if (jobs == kJobCount) { X_CHECK(IsInJobOrder(commands, *vertices)); }
+        X_CHECK(device.GetFrameStats().draws == jobs * kDrawsPerJob);
+    }
+}
+
+X_TEST(ParallelRecorder, ExecuteWithNoJobsDoesNothing) {
+    NullGraphicsDevice device;
+    GraphicsRecordingBackend backend(device);
+    ThreadPool pool(2);
+    ParallelRecorder<GraphicsRecordingBackend> recorder(backend, pool);
+    recorder.Execute();
+    X_CHECK(device.GetImmediateContext().GetCommands().empty());
+}
@@ -0,0 +1,82 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "RingAllocator.hpp"
+
+using namespace x;
+
+X_TEST(RingAllocator, AllocatesLinearlyWithAlignment) {
+    RingAllocator ring(1024);
+    const auto first = ring.Allocate(10);
+    X_REQUIRE(first.has_value());
+    X_CHECK(first->offset == 0 && first->size == 10 && !first->wrapped);
+
+    const auto second = ring.Allocate(16, 256);
+    X_REQUIRE(second.has_value());
+    X_CHECK(second->offset == 256);
+    X_CHECK(ring.GetHead() == 272);
+    X_CHECK(ring.GetUsed() == 272);  // Alignment padding counts as used
+}
+
+X_TEST(RingAllocator, RejectsEmptyAndOversizedRequests) {
+    RingAllocator ring(256);
+    X_CHECK(!ring.Allocate(0).has_value());
+    X_CHECK(!ring.Allocate(257).has_value());
+    X_CHECK(ring.Allocate(256).has_value());
+    X_CHECK(!ring.Allocate(1).has_value());
+}
+
+X_TEST(RingAllocator, WrapsOnlyOnceFramesRetire) {
+    RingAllocator ring(1000);
+    X_REQUIRE(ring.Allocate(600).has_value());
+    ring.EndFrame(1);
+    X_REQUIRE(ring.Allocate(300).has_value());
+    ring.EndFrame(2);
+
+    // Needs to wrap, and the bytes at the start still belong to frame 1
+    X_CHECK(!ring.Allocate(200).has_value());
+    X_CHECK(ring.GetPendingFrameCount() == 2);
+
+    ring.Retire(1);
+    X_CHECK(ring.GetPendingFrameCount() == 1);
+    X_CHECK(ring.GetUsed() == 300);
+    const auto wrapped = ring.Allocate(200);
+    X_REQUIRE(wrapped.has_value());
+    X_CHECK(wrapped->offset == 0 && wrapped->wrapped);
+    X_CHECK(ring.GetUsed() == 600);  // Includes the 100 tail bytes skipped by the wrap
+
+    // The wrapped allocation must not reach into frame 2, which still owns [600, 900)
+    X_CHECK(!ring.Allocate(500).has_value());
+    X_CHECK(ring.Allocate(400).has_value());
+}
+
+X_TEST(RingAllocator, RetireReleasesEverythingUpToTheFrame) {
+    RingAllocator ring(4096);
+    for (u64 frame = 1; frame <= 4; ++frame) {
+        X_REQUIRE(ring.Allocate(512, 64).has_value());
+        ring.EndFrame(frame);
+    }
+    ring.Retire(3);
+    X_CHECK(ring.GetUsed() == 512);
+    X_CHECK(ring.GetPendingFrameCount() == 1);
+    ring.Retire(4);
+    X_CHECK(ring.GetUsed() == 0);
+
+    // Steady state: a frame's worth per frame never runs out
+    for (u64 frame = 5; frame < 1000; ++frame) {
+        X_REQUIRE(ring.Allocate(1000, 16).has_value());
+        ring.EndFrame(frame);
+        ring.Retire(frame - 2);
+    }
+}
+
+X_TEST(RingAllocator, ResetDropsAllocationsAndFences) {
+    RingAllocator ring(128);
+    X_REQUIRE(ring.Allocate(100).has_value());
+    ring.EndFrame(1);
+    ring.Reset();
+    X_CHECK(ring.GetUsed() == 0 && ring.GetHead() == 0 && ring.GetPendingFrameCount() == 0);
+    X_CHECK(ring.Allocate(128).has_value());
+}
@@ -0,0 +1,72 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "ShaderBuildService.hpp"
+
+#include <atomic>
+
+using namespace x;
+
+namespace {
+    // Stands in for the compiler: the "bytecode" spells out the defines it was built with
+    CompiledShader CompileDefines(const ShaderSource& source) {
+        CompiledShader shader;
+        for (const auto& define : source.defines) {
+            const str text = "[" + define.name + "][" + define.value + "]";
+            shader.bytecode.insert(shader.bytecode.end(), text.begin(), text.end());
+        }
+        return shader;
+    }
+
+    str ToString(const vector<u8>& bytes) {
+        return str(bytes.begin(), bytes.end());
+    }
+
+    ShaderSource MakeSource(vector<ShaderDefine> defines) {
+        return {Filesystem::Path("Shaders/Lit.hlsl"), "PSMain", "ps_5_0", std::move(defines)};
+    }
+}  // namespace
+
+X_TEST(ShaderBuildService, IdenticalRequestsShareOneCompile) {
+    ThreadPool pool(2);
+    std::atomic<u32> compiles = 0;
+    ShaderBuildService service(pool, [&](const ShaderSource& source) {
+        compiles.fetch_add(1);
+        return CompileDefines(source);
+    });
+
+    const auto first  = service.Request(MakeSource({{"SHADOWS", "1"}}));
+    const auto second = service.Request(MakeSource({{"SHADOWS", "1"}}));
+    X_CHECK(first == second);
+    service.WaitAll();
+    X_CHECK(compiles.load() == 1);
+    X_CHECK(service.GetProgress().requested == 1 && service.GetProgress().completed == 1);
+}
+
+X_TEST(ShaderBuildService, FieldContentsCantForgeAnotherRequest) {
+    ThreadPool pool(2);
+    ShaderBuildService service(pool, CompileDefines);
+
+    // Each pair would produce the same key if fields were only joined with separators
+    const vector<std::pair<ShaderSource, ShaderSource>> pairs = {
+      {MakeSource({{"A", "1|B=2"}}), MakeSource({{"A", "1"}, {"B", "2"}})},
+      {MakeSource({{"A=1", ""}}), MakeSource({{"A", "=1"}})},
+      {MakeSource({{"A", "1"}, {"B", ""}}), MakeSource({{"A", "1|B="}})},
+    };
+    for (const auto& [left, right] : pairs) {
+        const auto leftTicket  = service.Request(left);
+        const auto rightTicket = service.Request(right);
+        X_REQUIRE(leftTicket != rightTicket);
+        X_CHECK(ToString(service.Wait(leftTicket).bytecode) ==
+                ToString(CompileDefines(left).bytecode));
+        X_CHECK(ToString(service.Wait(rightTicket).bytecode) ==
+                ToString(CompileDefines(right).bytecode));
+    }
+
+    auto entry       = MakeSource({});
+    entry.entryPoint = "PSMain|ps_5_0";
+    entry.target     = "";
+    X_CHECK(service.Request(entry) != service.Request(MakeSource({})));
+}
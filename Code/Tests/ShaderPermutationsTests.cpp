@@ -0,0 +1,64 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "ShaderPermutations.hpp"
+
+#include <cstdio>
+#include <filesystem>
+
+using namespace x;
+
+namespace {
+    Filesystem::Path ManifestPath() {
+        return Filesystem::Path(
+          (std::filesystem::temp_directory_path() / "xtests_variants.txt").string());
+    }
+
+    bool LoadText(ShaderVariantManifest& manifest, const str& text) {
+        const auto path = ManifestPath();
+        Filesystem::FileWriter::WriteAllText(path, text);
+        const bool loaded = manifest.Load(path);
+        std::remove(path.Str().c_str());
+        return loaded;
+    }
+}  // namespace
+
+X_TEST(ShaderPermutations, ManifestRoundTrips) {
+    ShaderVariantManifest saved;
+    saved.Record("Shaders/Lit.hlsl:PSMain:ps_5_0", 0);
+    saved.Record("Shaders/Lit.hlsl:PSMain:ps_5_0", 5);
+    saved.Record("Shaders/With Space.hlsl:VSMain:vs_5_0", 0xFFFFFFFFu);
+    const auto path = ManifestPath();
+    X_REQUIRE(saved.Save(path));
+
+    ShaderVariantManifest loaded;
+    X_CHECK(loaded.Load(path));
+    std::remove(path.Str().c_str());
+    const vector<ShaderKeywordMask> expected = {0, 5};
+    X_CHECK(loaded.GetVariants("Shaders/Lit.hlsl:PSMain:ps_5_0") == expected);
+    X_CHECK(loaded.Contains("Shaders/With Space.hlsl:VSMain:vs_5_0", 0xFFFFFFFFu));
+}
+
+X_TEST(ShaderPermutations, MalformedManifestsFailWithoutRecording) {
+    const char* malformed[] = {
+      "Lit 3\nLit 4294967296\n",  // Doesn't fit a mask
+      "Lit 3\nLit seven\n",
+      "Lit 3\nLit -1\n",
+      "Lit 3\nLit 12abc\n",
+      "Lit 3\nLit \n",
+      "Lit 3\nNoMask\n",
+      " 3\n",
+    };
+    for (const char* text : malformed) {
+        ShaderVariantManifest manifest;
+        X_CHECK(!LoadText(manifest, text));
+        X_CHECK(!manifest.Contains("Lit", 3));
+    }
+
+    ShaderVariantManifest manifest;
+    X_CHECK(LoadText(manifest, "Lit 3\r\n\r\nLit 4294967295\r\n"));
+    X_CHECK(manifest.Contains("Lit", 3) && manifest.Contains("Lit", 0xFFFFFFFFu));
+    X_CHECK(!manifest.Load(Filesystem::Path("xtests_missing_manifest.txt")));
+}
@@ -0,0 +1,50 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include <cstdio>
+
+namespace x::test {
+    using TestFunction = void (*)();
+
+    struct TestCase {
+        const char* suite;
+        const char* name;
+        TestFunction function;
+    };
+
+    vector<TestCase>& GetRegistry();
+
+    // Counts failed checks in the running test.
+    void ReportFailure(const char* file, i32 line, const char* expression);
+
+    struct Registrar {
+        Registrar(const char* suite, const char* name, TestFunction function) {
+            GetRegistry().push_back({suite, name, function});
+        }
+    };
+}  // namespace x::test
+
+// Defines a test registered under "Suite.Name". Tests run in registration order.
+#define X_TEST(Suite, Name)                                                                        \
+    static void Suite##_##Name();                                                                  \
+    static const x::test::Registrar Suite##_##Name##_registrar(#Suite, #Name, Suite##_##Name);     \
+    static void Suite##_##Name()
+
+// Records a failure and carries on, so one run reports every broken check.
+#define X_CHECK(expression)                                                                        \
+    do {                                                                                           \
+        if (!(expression)) { x::test::ReportFailure(__FILE__, __LINE__, #expression); }            \
+    } while (false)
+
+// Records a failure and leaves the test, for checks the rest of the test depends on.
+#define X_REQUIRE(expression)                                                                      \
+    do {                                                                                           \
+        if (!(expression)) {                                                                       \
+            x::test::ReportFailure(__FILE__, __LINE__, #expression);                               \
+            return;                                                                                \
+        }                                                                                          \
+    } while (false)
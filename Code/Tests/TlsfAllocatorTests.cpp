@@ -0,0 +1,224 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+#include "TlsfAllocator.hpp"
+
+#include <random>
+
+using namespace x;
+
+namespace {
+    using Handle                    = TlsfAllocator::Handle;
+    constexpr Handle kInvalidHandle = TlsfAllocator::kInvalidHandle;
+}  // namespace
+
+X_TEST(TlsfAllocator, AllocatesFromTheFront) {
+    TlsfAllocator allocator(1024);
+    const Handle first  = allocator.Allocate(100);
+    const Handle second = allocator.Allocate(200);
+    X_REQUIRE(first != kInvalidHandle && second != kInvalidHandle);
+    X_CHECK(allocator.GetOffset(first) == 0 && allocator.GetSize(first) == 100);
+    X_CHECK(allocator.GetOffset(second) == 100 && allocator.GetSize(second) == 200);
+    X_CHECK(allocator.GetUsed() == 300 && allocator.GetAllocationCount() == 2);
+    X_CHECK(allocator.GetFreeBlockCount() == 1);
+    X_CHECK(allocator.Validate());
+}
+
+X_TEST(TlsfAllocator, CoalescesWithBothNeighbours) {
+    TlsfAllocator allocator(1000);
+    const Handle a = allocator.Allocate(100);
+    const Handle b = allocator.Allocate(100);
+    const Handle c = allocator.Allocate(100);
+    X_REQUIRE(a != kInvalidHandle && b != kInvalidHandle && c != kInvalidHandle);
+
+    allocator.Free(a);
+    X_CHECK(allocator.GetFreeBlockCount() == 2);
+    allocator.Free(c);  // Merges into the tail
+    X_CHECK(allocator.GetFreeBlockCount() == 2);
+    X_CHECK(allocator.GetLargestFreeBlock() == 800);
+    allocator.Free(b);  // Bridges both free blocks
+    X_CHECK(allocator.GetFreeBlockCount() == 1);
+    X_CHECK(allocator.GetLargestFreeBlock() == 1000);
+    X_CHECK(allocator.GetUsed() == 0 && allocator.GetAllocationCount() == 0);
+    X_CHECK(allocator.Validate());
+
+    // The whole range is one block again
+    const Handle whole = allocator.Allocate(1000);
+    X_REQUIRE(whole != kInvalidHandle);
+    X_CHECK(allocator.GetOffset(whole) == 0);
+}
+
+X_TEST(TlsfAllocator, FreeIgnoresInvalidAndRepeatedHandles) {
+    TlsfAllocator allocator(256);
+    const Handle handle = allocator.Allocate(64);
+    X_REQUIRE(handle != kInvalidHandle);
+    allocator.Free(kInvalidHandle);
+    allocator.Free(handle);
+    allocator.Free(handle);
+    X_CHECK(allocator.GetUsed() == 0 && allocator.GetAllocationCount() == 0);
+    X_CHECK(allocator.Validate());
+}
+
+X_TEST(TlsfAllocator, RejectsHandlesWhoseNodeWasMerged) {
+    TlsfAllocator allocator(1000);
+    const Handle first  = allocator.Allocate(100);
+    const Handle second = allocator.Allocate(100);
+    const Handle third  = allocator.Allocate(100);
+    X_REQUIRE(first != kInvalidHandle && second != kInvalidHandle && third != kInvalidHandle);
+
+    allocator.Free(first);
+    allocator.Free(second);  // Merges into the free block left by `first`
+    X_CHECK(!allocator.IsValid(second));
+    allocator.Free(second);
+    X_CHECK(allocator.Validate());
+    X_CHECK(allocator.GetUsed() == 100 && allocator.GetAllocationCount() == 1);
+    X_CHECK(allocator.GetFreeBlockCount() == 2);
+    X_CHECK(allocator.IsValid(third) && allocator.GetOffset(third) == 200);
+}
+
+X_TEST(TlsfAllocator, StaleHandlesDontFreeLaterAllocations) {
+    TlsfAllocator allocator(1024);
+    const Handle stale = allocator.Allocate(64);
+    X_REQUIRE(stale != kInvalidHandle);
+    allocator.Free(stale);
+
+    // Reuses the same node and offset under a new handle
+    const Handle fresh = allocator.Allocate(64);
+    X_REQUIRE(fresh != kInvalidHandle && fresh != stale);
+    X_CHECK(allocator.GetOffset(fresh) == 0);
+    allocator.Free(stale);
+    X_CHECK(allocator.IsValid(fresh) && allocator.GetAllocationCount() == 1);
+
+    allocator.Reset();
+    X_CHECK(!allocator.IsValid(fresh));
+    const Handle afterReset = allocator.Allocate(64);
+    X_CHECK(afterReset != fresh && !allocator.IsValid(stale));
+    X_CHECK(!allocator.IsValid(kInvalidHandle) && !allocator.IsValid(0));
+    X_CHECK(allocator.Validate());
+}
+
+X_TEST(TlsfAllocator, AlignsOffsetsAndKeepsPaddingFree) {
+    TlsfAllocator allocator(4096);
+    const Handle odd = allocator.Allocate(3);
+    X_REQUIRE(odd != kInvalidHandle);
+
+    const Handle aligned = allocator.Allocate(100, 256);
+    X_REQUIRE(aligned != kInvalidHandle);
+    X_CHECK(allocator.GetOffset(aligned) == 256);
+    X_CHECK(allocator.GetUsed() == 103);
+    X_CHECK(allocator.Validate());
+
+    // The padding is reusable by allocations that fit it
+    const Handle filler = allocator.Allocate(200);
+    X_REQUIRE(filler != kInvalidHandle);
+    X_CHECK(allocator.GetOffset(filler) < 256);
+
+    for (u32 alignment = 1; alignment <= 1024; alignment <<= 1) {
+        const Handle handle = allocator.Allocate(7, alignment);
+        X_REQUIRE(handle != kInvalidHandle);
+        X_CHECK(allocator.GetOffset(handle) % alignment == 0);
+    }
+    X_CHECK(allocator.Validate());
+
+    X_CHECK(allocator.Allocate(16, 0) == kInvalidHandle);
+    X_CHECK(allocator.Allocate(16, 3) == kInvalidHandle);
+}
+
+X_TEST(TlsfAllocator, FailsCleanlyWhenOutOfSpace) {
+    TlsfAllocator allocator(1024);
+    X_CHECK(allocator.Allocate(0) == kInvalidHandle);
+    X_CHECK(allocator.Allocate(1025) == kInvalidHandle);
+    X_CHECK(allocator.Allocate(1024, 2048) == kInvalidHandle);
+
+    vector<Handle> handles;
+    for (u32 i = 0; i < 8; ++i) {
+        handles.push_back(allocator.Allocate(128));
+        X_REQUIRE(handles.back() != kInvalidHandle);
+    }
+    X_CHECK(allocator.Allocate(1) == kInvalidHandle);
+    X_CHECK(allocator.GetFreeBlockCount() == 0);
+
+    // Enough space in total but not in one piece
+    allocator.Free(handles[1]);
+    allocator.Free(handles[3]);
+    X_CHECK(allocator.GetUsed() == 768);
+    X_CHECK(allocator.Allocate(200) == kInvalidHandle);
+    X_CHECK(allocator.Allocate(128) != kInvalidHandle);
+    X_CHECK(allocator.Validate());
+}
+
+X_TEST(TlsfAllocator, DefragmentCompactsAndKeepsAlignment) {
+    TlsfAllocator allocator(8192);
+    vector<Handle> handles;
+    for (u32 i = 0; i < 16; ++i) {
+        handles.push_back(allocator.Allocate(100 + i, i % 4 == 0 ? 64 : 1));
+        X_REQUIRE(handles.back() != kInvalidHandle);
+    }
+    for (u32 i = 0; i < 16; i += 2) {
+        allocator.Free(handles[i]);
+    }
+    const Handle aligned = allocator.Allocate(50, 128);
+    X_REQUIRE(aligned != kInvalidHandle);
+
+    const u32 used                          = allocator.GetUsed();
+    const vector<TlsfAllocator::Move> moves = allocator.Defragment();
+    X_CHECK(allocator.Validate());
+    X_CHECK(allocator.GetUsed() == used);
+    X_CHECK(allocator.GetOffset(aligned) % 128 == 0);
+
+    u32 lastDestination = 0;
+    for (const auto& move : moves) {
+        X_CHECK(move.dstOffset < move.srcOffset);
+        X_CHECK(move.dstOffset >= lastDestination);
+        X_CHECK(allocator.GetOffset(move.handle) == move.dstOffset);
+        lastDestination = move.dstOffset + move.size;
+    }
+
+    // Only padding for the aligned block may be left between live blocks
+    X_CHECK(allocator.GetLargestFreeBlock() >= allocator.GetCapacity() - used - 128);
+}
+
+X_TEST(TlsfAllocator, RandomChurnKeepsInvariants) {
+    constexpr u32 kCapacity = 1 << 20;
+    TlsfAllocator allocator(kCapacity);
+    std::mt19937 random(0x5eed);
+    std::uniform_int_distribution<u32> sizes(1, 4096);
+    std::uniform_int_distribution<u32> alignments(0, 6);
+
+    vector<Handle> live;
+    for (u32 step = 0; step < 20'000; ++step) {
+        if (live.empty() || random() % 100 < 55) {
+            const u32 size      = sizes(random);
+            const u32 alignment = 1u << alignments(random);
+            const Handle handle = allocator.Allocate(size, alignment);
+            if (handle != kInvalidHandle) {
+                X_CHECK(allocator.GetOffset(handle) % alignment == 0);
+                X_CHECK(allocator.GetSize(handle) == size);
+                live.push_back(handle);
+            }
+        } else {
+            const size_t victim = random() % live.size();
+            allocator.Free(live[victim]);
+            live[victim] = live.back();
+            live.pop_back();
+        }
+
+        if (step % 500 == 0) {
+            X_REQUIRE(allocator.Validate());
+            X_CHECK(allocator.GetAllocationCount() == live.size());
+        }
+        if (step % 5000 == 4999) {
+            allocator.Defragment();
+            X_REQUIRE(allocator.Validate());
+        }
+    }
+
+    for (const Handle handle : live) {
+        allocator.Free(handle);
+    }
+    X_CHECK(allocator.Validate());
+    X_CHECK(allocator.GetUsed() == 0 && allocator.GetFreeBlockCount() == 1);
+    X_CHECK(allocator.GetLargestFreeBlock() == kCapacity);
+}
@@ -0,0 +1,51 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Test.hpp"
+
+#include <cstring>
+
+namespace x::test {
+    namespace {
+        u32 gFailures = 0;
+    }
+
+    vector<TestCase>& GetRegistry() {
+        static vector<TestCase> registry;
+        return registry;
+    }
+
+    void ReportFailure(const char* file, i32 line, const char* expression) {
+        printf("%s:%d: check failed: %s\n", file, line, expression);
+        ++gFailures;
+    }
+}  // namespace x::test
+
+// Runs every test, or only the suites named on the command line. Exits non-zero if any check
+// failed or a named suite has no tests.
+int main(int argc, char* argv[]) {
+    using namespace x::test;
+
+    const auto selected = [&](const char* suite) {
+        if (argc < 2) { return true; }
+        for (int arg = 1; arg < argc; ++arg) {
+            if (strcmp(argv[arg], suite) == 0) { return true; }
+        }
+        return false;
+    };
+
+    x::u32 run = 0, failed = 0;
+    for (const TestCase& test : GetRegistry()) {
+        if (!selected(test.suite)) { continue; }
+        const x::u32 before = gFailures;
+        test.function();
+        ++run;
+        const bool passed = gFailures == before;
+        if (!passed) { ++failed; }
+        printf("[%s] %s.%s\n", passed ? "PASS" : "FAIL", test.suite, test.name);
+    }
+
+    printf("%u tests, %u failed\n", run, failed);
+    return run == 0 || failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include "PackArchive.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+using namespace x;
+
+// Packs every regular file under each input directory into one .xpak. Entry names are
+// relative to their input directory, so mount the archive where that directory used to be.
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <output.xpak> <input directory>...\n", argv[0]);
+        return 1;
+    }
+
+    Filesystem::PackWriter writer;
+    for (int i = 2; i < argc; ++i) {
+        const std::filesystem::path root(argv[i]);
+        std::error_code error;
+        if (!std::filesystem::is_directory(root, error)) {
+            fprintf(stderr, "Not a directory: %s\n", argv[i]);
+            return 1;
+        }
+
+        // Sorted so identical inputs produce identical archives
+        vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root, error)) {
+            if (entry.is_regular_file()) { files.push_back(entry.path()); }
+        }
+        if (error) {
+            fprintf(stderr, "Failed to scan %s: %s\n", argv[i], error.message().c_str());
+            return 1;
+        }
+        std::sort(files.begin(), files.end());
+
+        for (const auto& file : files) {
+            const str name = std::filesystem::relative(file, root).generic_string();
+            writer.AddFile(name, Filesystem::Path(file.string()));
+        }
+    }
+
+    if (!writer.Write(Filesystem::Path(argv[1]))) {
+        fprintf(stderr, "Failed to write %s (unreadable input or duplicate entry name)\n", argv[1]);
+        return 1;
+    }
+    printf("Packed %zu files into %s\n", writer.GetEntryCount(), argv[1]);
+    return 0;
+}
@@ -0,0 +1,485 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "AssetManager.hpp"
+#include "MemoryTracker.hpp"
+#include "Panic.inl"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace x {
+#pragma region AssetRef
+    AssetRef::AssetRef(const AssetRef& other) : _manager(other._manager), _id(other._id) {
+        if (_manager) { _manager->AddRef(_id.index); }
+    }
+
+    AssetRef::AssetRef(AssetRef&& other) noexcept : _manager(other._manager), _id(other._id) {
+        other._manager = None;
+        other._id      = {};
+    }
+
+    AssetRef& AssetRef::operator=(const AssetRef& other) {
+        if (this != &other) {
+            AssetRef copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    AssetRef& AssetRef::operator=(AssetRef&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            _manager       = other._manager;
+            _id            = other._id;
+            other._manager = None;
+            other._id      = {};
+        }
+        return *this;
+    }
+
+    AssetRef::~AssetRef() {
+        Reset();
+    }
+
+    AssetState AssetRef::GetState() const {
+        return _manager ? _manager->GetState(_id.index) : AssetState::Unloaded;
+    }
+
+    AssetState AssetRef::Wait() const {
+        return _manager ? _manager->Wait(_id.index) : AssetState::Unloaded;
+    }
+
+    void AssetRef::Reset() {
+        if (!_manager) { return; }
+        _manager->Release(_id.index);
+        _manager = None;
+        _id      = {};
+    }
+
+    const void* AssetRef::GetAsset() const {
+        return _manager ? _manager->GetAsset(_id.index) : None;
+    }
+#pragma endregion
+
+#pragma region AssetLoadContext
+    Filesystem::Path AssetLoadContext::Resolve(const str& path) const {
+        // Asset files may be authored on either platform
+        str native = path;
+        std::replace(native.begin(), native.end(), '/', PATH_SEPARATOR);
+        std::replace(native.begin(), native.end(), '\\', PATH_SEPARATOR);
+        if ((!native.empty() && native.front() == PATH_SEPARATOR) ||
+            native.find(':') != str::npos) {
+            return Filesystem::Path(native);
+        }
+        return _path.Parent() / native;
+    }
+#pragma endregion
+
+#pragma region AssetManager
+    AssetManager::AssetManager(ThreadPool& decodePool, const AssetManagerOptions& options)
+        : _decodePool(decodePool), _options(options) {}
+
+    AssetManager::~AssetManager() {
+        WaitIdle();
+        // Parked assets may hold handles into this manager. Anything they evict from here on
+        // is destroyed directly.
+        if (DeferredReleaseQueue* queue = std::exchange(_options.releaseQueue, None)) {
+            queue->Flush();
+        }
+        Trim();
+
+        // Trim() evicted everything unreferenced, so a slot still in use has a handle that
+        // would call back into this manager after it is gone
+        for (u32 index = 0; index < _slotCount; ++index) {
+            const Slot& slot = GetSlot(index);
+            if (slot.refCount.load(std::memory_order_acquire) != 0) {
+                Panic("Asset %s is still referenced by a handle that outlived its AssetManager",
+                      slot.path.CStr());
+            }
+        }
+        for (auto& chunk : _chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    void AssetManager::SetMemoryBudget(size_t bytes) {
+        Released released(_options.releaseQueue);
+        std::lock_guard lock(_mutex);
+        _options.memoryBudget = bytes;
+        EnforceBudgetLocked(bytes, released);
+    }
+
+    size_t AssetManager::GetMemoryBudget() const {
+        std::lock_guard lock(_mutex);
+        return _options.memoryBudget;
+    }
+
+    void AssetManager::Trim() {
+        // Evicts by LRU membership, not bytes, since assets can report a size of 0. Evicting an
+        // asset drops its references to its dependencies, which then become evictable in turn.
+        for (;;) {
+            Released released(_options.releaseQueue);
+            std::lock_guard lock(_mutex);
+            if (_lruHead == kNoSlot) { break; }
+            while (_lruHead != kNoSlot) {
+                EvictLocked(_lruHead, released);
+            }
+        }
+    }
+
+    void AssetManager::WaitIdle() {
+        std::unique_lock lock(_mutex);
+        _changed.wait(lock, [this]() { return _inFlight == 0 && _pendingDecodes == 0; });
+    }
+
+    AssetStats AssetManager::GetStats() const {
+        std::lock_guard lock(_mutex);
+        AssetStats stats;
+        for (u32 index = 0; index < _slotCount; ++index) {
+            const Slot& slot = GetSlot(index);
+            switch (slot.state.load(std::memory_order_relaxed)) {
+                case AssetState::Loading:
+                    ++stats.loading;
+                    break;
+                case AssetState::Ready:
+                    ++stats.resident;
+                    if (slot.inLru) { ++stats.unreferenced; }
+                    break;
+                case AssetState::Failed:
+                    ++stats.failed;
+                    break;
+                default:
+                    break;
+            }
+        }
+        stats.memoryUsed   = _memoryUsed;
+        stats.memoryBudget = _options.memoryBudget;
+        stats.loads        = _loads;
+        stats.hits         = _hits;
+        stats.evictions    = _evictions;
+        return stats;
+    }
+
+    void AssetManager::RegisterLoader(const std::type_info& type,
+                                      ErasedLoad load,
+                                      ErasedDestroy destroy) {
+        std::lock_guard lock(_mutex);
+        auto& loader = _loaders[std::type_index(type)];
+        if (loader) { Panic("A loader for %s is already registered", type.name()); }
+        loader = make_unique<Loader>(Loader {std::move(load), destroy});
+    }
+
+    AssetRef AssetManager::LoadUntyped(const Filesystem::Path& path, const std::type_info& type) {
+        const Filesystem::InternedPath key(path);
+        AssetId id;
+        {
+            std::lock_guard lock(_mutex);
+            if (const auto it = _byPath.find(key); it != _byPath.end()) {
+                const Slot& slot = GetSlot(it->second);
+                if (*slot.type != type) {
+                    Panic("Asset %s requested as %s but loaded as %s",
+                          path.CStr(),
+                          type.name(),
+                          slot.type->name());
+                }
+                AcquireLocked(it->second);
+                ++_hits;
+                return AssetRef(this, {it->second, slot.generation});
+            }
+
+            const auto loader = _loaders.find(std::type_index(type));
+            if (loader == _loaders.end()) { Panic("No loader registered for %s", type.name()); }
+
+            id.index   = AllocateSlot();
+            Slot& slot = GetSlot(id.index);
+
+            slot.type       = &type;
+            slot.loader     = loader->second.get();
+            slot.path       = key;
+            slot.memorySize = 0;
+            slot.refCount.store(1, std::memory_order_relaxed);
+            slot.state.store(AssetState::Loading, std::memory_order_relaxed);
+            id.generation = slot.generation;
+
+            _byPath.emplace(key, id.index);
+            ++_inFlight;
+            ++_pendingDecodes;
+            ++_loads;
+        }
+
+        // Decoding is CPU work, so it moves off the I/O threads as soon as the bytes arrive
+        const u32 index = id.index;
+        IoQueue::Global().Read(
+          path, 0, 0, _options.priority, {}, [this, index](vector<u8>&& data, bool) {
+              _decodePool.Enqueue([this, index, data = std::move(data)]() mutable {
+                  Decode(index, std::move(data));
+              });
+          });
+        return AssetRef(this, id);
+    }
+
+    AssetRef AssetManager::LockUntyped(AssetId id, const std::type_info& type) {
+        std::lock_guard lock(_mutex);
+        if (!id.valid() || id.index >= _slotCount) { return {}; }
+        const Slot& slot = GetSlot(id.index);
+        if (slot.generation != id.generation ||
+            slot.state.load(std::memory_order_relaxed) == AssetState::Unloaded ||
+            *slot.type != type) {
+            return {};
+        }
+        AcquireLocked(id.index);
+        return AssetRef(this, id);
+    }
+
+    AssetManager::Slot& AssetManager::GetSlot(u32 index) const {
+        Slot* chunk = _chunks[index / kSlotsPerChunk].load(std::memory_order_acquire);
+        return chunk[index % kSlotsPerChunk];
+    }
+
+    u32 AssetManager::AllocateSlot() {
+        if (_freeSlot != kNoSlot) {
+            const u32 index = _freeSlot;
+            _freeSlot       = GetSlot(index).nextFree;
+            return index;
+        }
+
+        const u32 index = _slotCount;
+        const u32 chunk = index / kSlotsPerChunk;
+        if (chunk >= kMaxChunks) { Panic("Asset slot table is full"); }
+        if (!_chunks[chunk].load(std::memory_order_relaxed)) {
+            _chunks[chunk].store(new Slot[kSlotsPerChunk], std::memory_order_release);
+        }
+        ++_slotCount;
+        return index;
+    }
+
+    void AssetManager::AddRef(u32 index) {
+        // Only ever called with another reference alive, so the count can't be leaving zero
+        GetSlot(index).refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AssetManager::Release(u32 index) {
+        Slot& slot = GetSlot(index);
+        if (slot.refCount.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
+
+        Released released(_options.releaseQueue);
+        std::lock_guard lock(_mutex);
+        // Someone may have re-acquired it (or even freed it) before we got the lock
+        if (slot.refCount.load(std::memory_order_relaxed) != 0) { return; }
+        switch (slot.state.load(std::memory_order_relaxed)) {
+            case AssetState::Ready:
+                if (!slot.inLru) { LinkLru(index); }
+                EnforceBudgetLocked(_options.memoryBudget, released);
+                break;
+            case AssetState::Failed:
+                // Forget it, so the next request retries
+                FreeSlotLocked(index);
+                break;
+            default:
+                // Still loading; FinishLocked parks or frees it
+                break;
+        }
+    }
+
+    AssetState AssetManager::GetState(u32 index) const {
+        return GetSlot(index).state.load(std::memory_order_acquire);
+    }
+
+    AssetState AssetManager::Wait(u32 index) const {
+        const Slot& slot = GetSlot(index);
+        std::unique_lock lock(_mutex);
+        _changed.wait(lock, [&slot]() {
+            return slot.state.load(std::memory_order_relaxed) != AssetState::Loading;
+        });
+        return slot.state.load(std::memory_order_relaxed);
+    }
+
+    const void* AssetManager::GetAsset(u32 index) const {
+        const Slot& slot = GetSlot(index);
+        if (slot.state.load(std::memory_order_acquire) != AssetState::Ready) { return None; }
+        return slot.asset;
+    }
+
+    void AssetManager::Decode(u32 index, vector<u8> bytes) {
+        X_PROFILE_FUNCTION();
+        const MemoryScope memoryScope(MemoryTag::Assets);
+        Slot& slot = GetSlot(index);
+        AssetLoadContext context(*this, slot.path.ToPath(), bytes.size());
+        // Dependencies requested here start loading immediately, in parallel with each other
+        void* asset = bytes.empty() ? None : slot.loader->load(bytes, context);
+
+        {
+            Released released(_options.releaseQueue);
+            std::lock_guard lock(_mutex);
+            slot.asset        = asset;
+            slot.memorySize   = context._memorySize;
+            slot.dependencies = std::move(context._dependencies);
+
+            bool ok     = asset != None;
+            u32 pending = 0;
+            for (const auto& dependency : slot.dependencies) {
+                if (!ok) { break; }
+                const u32 other = dependency._id.index;
+                switch (GetSlot(other).state.load(std::memory_order_relaxed)) {
+                    case AssetState::Ready:
+                        break;
+                    case AssetState::Loading:
+                        // Waiting on something that (transitively) waits on us would never finish
+                        if (other == index || DependsOn(other, index)) {
+                            ok = false;
+                            break;
+                        }
+                        GetSlot(other).dependents.push_back(index);
+                        ++pending;
+                        break;
+                    default:
+                        ok = false;
+                        break;
+                }
+            }
+            slot.pendingDependencies = pending;
+            if (!ok || pending == 0) { FinishLocked(index, ok, released); }
+        }
+
+        // Only once what this decode let go of is gone, so WaitIdle() (and the destructor)
+        // can't overtake it
+        std::lock_guard lock(_mutex);
+        --_pendingDecodes;
+        _changed.notify_all();
+    }
+
+    bool AssetManager::DependsOn(u32 from, u32 target) const {
+        vector<u32> stack {from};
+        std::unordered_set<u32> visited;
+        while (!stack.empty()) {
+            const u32 index = stack.back();
+            stack.pop_back();
+            if (!visited.insert(index).second) { continue; }
+            for (const auto& dependency : GetSlot(index).dependencies) {
+                const u32 next = dependency._id.index;
+                if (next == target) { return true; }
+                if (GetSlot(next).state.load(std::memory_order_relaxed) == AssetState::Loading) {
+                    stack.push_back(next);
+                }
+            }
+        }
+        return false;
+    }
+
+    void AssetManager::AcquireLocked(u32 index) {
+        Slot& slot = GetSlot(index);
+        if (slot.refCount.fetch_add(1, std::memory_order_relaxed) == 0 && slot.inLru) {
+            UnlinkLru(index);
+        }
+    }
+
+    void AssetManager::FinishLocked(u32 index, bool ok, Released& released) {
+        Slot& slot = GetSlot(index);
+        if (ok) {
+            _memoryUsed += slot.memorySize;
+        } else {
+            if (slot.asset) {
+                released.assets.push_back({slot.asset, slot.loader->destroy, slot.memorySize});
+            }
+            slot.asset = None;
+            for (auto& dependency : slot.dependencies) {
+                released.references.push_back(std::move(dependency));
+            }
+            slot.dependencies.clear();
+        }
+        slot.state.store(ok ? AssetState::Ready : AssetState::Failed, std::memory_order_release);
+        --_inFlight;
+
+        const vector<u32> dependents = std::move(slot.dependents);
+        slot.dependents.clear();
+        for (const u32 dependent : dependents) {
+            Slot& waiting = GetSlot(dependent);
+            if (waiting.state.load(std::memory_order_relaxed) != AssetState::Loading) { continue; }
+            if (!ok) {
+                FinishLocked(dependent, false, released);
+            } else if (--waiting.pendingDependencies == 0) {
+                FinishLocked(dependent, true, released);
+            }
+        }
+
+        // Every handle was dropped while it loaded
+        if (slot.refCount.load(std::memory_order_relaxed) == 0) {
+            if (ok) {
+                LinkLru(index);
+            } else {
+                FreeSlotLocked(index);
+            }
+        }
+        _changed.notify_all();
+        if (ok) { EnforceBudgetLocked(_options.memoryBudget, released); }
+    }
+
+    void AssetManager::EvictLocked(u32 index, Released& released) {
+        Slot& slot = GetSlot(index);
+        UnlinkLru(index);
+        released.assets.push_back({slot.asset, slot.loader->destroy, slot.memorySize});
+        slot.asset = None;
+        for (auto& dependency : slot.dependencies) {
+            released.references.push_back(std::move(dependency));
+        }
+        slot.dependencies.clear();
+        _memoryUsed -= slot.memorySize;
+        ++_evictions;
+        FreeSlotLocked(index);
+    }
+
+    void AssetManager::FreeSlotLocked(u32 index) {
+        Slot& slot = GetSlot(index);
+        _byPath.erase(slot.path);
+        slot.state.store(AssetState::Unloaded, std::memory_order_relaxed);
+        // Stale ids stop resolving; 0 stays reserved for "never issued"
+        if (++slot.generation == 0) { slot.generation = 1; }
+        slot.type                = None;
+        slot.loader              = None;
+        slot.memorySize          = 0;
+        slot.pendingDependencies = 0;
+        slot.dependents.clear();
+        slot.nextFree = _freeSlot;
+        _freeSlot     = index;
+    }
+
+    void AssetManager::EnforceBudgetLocked(size_t budget, Released& released) {
+        while (_memoryUsed > budget && _lruHead != kNoSlot) {
+            EvictLocked(_lruHead, released);
+        }
+    }
+
+    void AssetManager::LinkLru(u32 index) {
+        Slot& slot   = GetSlot(index);
+        slot.inLru   = true;
+        slot.lruPrev = _lruTail;
+        slot.lruNext = kNoSlot;
+        if (_lruTail != kNoSlot) {
+            GetSlot(_lruTail).lruNext = index;
+        } else {
+            _lruHead = index;
+        }
+        _lruTail = index;
+    }
+
+    void AssetManager::UnlinkLru(u32 index) {
+        Slot& slot = GetSlot(index);
+        if (slot.lruPrev != kNoSlot) {
+            GetSlot(slot.lruPrev).lruNext = slot.lruNext;
+        } else {
+            _lruHead = slot.lruNext;
+        }
+        if (slot.lruNext != kNoSlot) {
+            GetSlot(slot.lruNext).lruPrev = slot.lruPrev;
+        } else {
+            _lruTail = slot.lruPrev;
+        }
+        slot.inLru   = false;
+        slot.lruPrev = kNoSlot;
+        slot.lruNext = kNoSlot;
+    }
+#pragma endregion
+}  // namespace x
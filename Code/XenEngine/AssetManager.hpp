@@ -0,0 +1,337 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "DeferredReleaseQueue.hpp"
+#include "Filesystem.hpp"
+#include "InternedPath.hpp"
+#include "IoQueue.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <typeindex>
+#include <typeinfo>
+
+namespace x {
+    class AssetManager;
+
+    enum class AssetState : u8 {
+        Unloaded,
+        Loading,  // Reading, decoding, or waiting on dependencies
+        Ready,
+        Failed,  // Unreadable, rejected by its loader, or a dependency failed
+    };
+
+    // Slot index plus generation. Evicting an asset bumps its slot's generation, so an id kept
+    // past eviction no longer resolves instead of aliasing whatever reuses the slot.
+    struct AssetId {
+        u32 index      = 0;
+        u32 generation = 0;  // 0 is never issued
+
+        bool valid() const {
+            return generation != 0;
+        }
+
+        // Packed form, e.g. for InstanceBatcher's mesh and material keys.
+        u64 value() const {
+            return u64(generation) << 32 | index;
+        }
+
+        bool operator==(const AssetId&) const = default;
+    };
+
+    // Owning reference to an asset of any type. Copies share the reference; the asset stays
+    // resident while any reference exists and becomes evictable once the last one goes away.
+    class AssetRef {
+    public:
+        AssetRef() = default;
+        AssetRef(const AssetRef& other);
+        AssetRef(AssetRef&& other) noexcept;
+        AssetRef& operator=(const AssetRef& other);
+        AssetRef& operator=(AssetRef&& other) noexcept;
+        ~AssetRef();
+
+        AssetId GetId() const {
+            return _id;
+        }
+
+        bool IsValid() const {
+            return _manager != None;
+        }
+
+        AssetState GetState() const;
+
+        bool IsReady() const {
+            return GetState() == AssetState::Ready;
+        }
+
+        // Blocks until the asset and everything it depends on has loaded or failed.
+        AssetState Wait() const;
+
+        void Reset();
+
+    protected:
+        friend class AssetManager;
+
+        // Adopts a reference the manager has already counted.
+        AssetRef(AssetManager* manager, AssetId id) : _manager(manager), _id(id) {}
+
+        const void* GetAsset() const;
+
+        AssetManager* _manager = None;
+        AssetId _id;
+    };
+
+    template<typename T>
+    class AssetHandle final : public AssetRef {
+    public:
+        AssetHandle() = default;
+
+        // None until the asset is Ready. Valid for as long as this handle is held.
+        const T* Get() const {
+            return CAST<const T*>(GetAsset());
+        }
+
+        const T* operator->() const {
+            return Get();
+        }
+
+        const T& operator*() const {
+            return *Get();
+        }
+
+    private:
+        friend class AssetManager;
+
+        explicit AssetHandle(AssetRef&& ref) : AssetRef(std::move(ref)) {}
+    };
+
+    // Handed to a loader while it decodes one asset.
+    class AssetLoadContext {
+    public:
+        const Filesystem::Path& GetPath() const {
+            return _path;
+        }
+
+        // Relative paths resolve against the directory of the asset being loaded.
+        Filesystem::Path Resolve(const str& path) const;
+
+        // Starts loading a dependency right away, so every dependency a loader names is in
+        // flight at once. The asset being decoded only becomes Ready once all of them are,
+        // and fails if any of them does (including through a dependency cycle). Loaders must
+        // not Wait() on what this returns.
+        template<typename T>
+        AssetHandle<T> Load(const str& path);
+
+        // Defaults to the size of the file.
+        void SetMemorySize(size_t bytes) {
+            _memorySize = bytes;
+        }
+
+    private:
+        friend class AssetManager;
+
+        AssetLoadContext(AssetManager& manager, Filesystem::Path path, size_t memorySize)
+            : _manager(manager), _path(std::move(path)), _memorySize(memorySize) {}
+
+        AssetManager& _manager;
+        Filesystem::Path _path;
+        vector<AssetRef> _dependencies;
+        size_t _memorySize;
+    };
+
+    struct AssetManagerOptions {
+        // Unreferenced assets are evicted, least recently released first, while resident
+        // assets use more than this. Referenced assets are never evicted, so the budget can be
+        // exceeded when everything is in use.
+        size_t memoryBudget = 512ull * 1024 * 1024;
+        IoPriority priority = IoPriority::Normal;
+        // Evicted and failed assets are destroyed through this queue, so their GPU resources
+        // outlive the frames that may still use them. Must outlive the manager, which flushes
+        // it on destruction. None destroys them immediately.
+        DeferredReleaseQueue* releaseQueue = None;
+    };
+
+    struct AssetStats {
+        u32 resident        = 0;  // Ready, including unreferenced ones
+        u32 unreferenced    = 0;
+        u32 loading         = 0;
+        u32 failed          = 0;
+        size_t memoryUsed   = 0;
+        size_t memoryBudget = 0;
+        u64 loads           = 0;  // Requests that started a load
+        u64 hits            = 0;  // Requests served by an asset already loaded or loading
+        u64 evictions       = 0;
+    };
+
+    // Loads, shares and evicts assets. Each file is loaded at most once: requesting a path
+    // that is resident or in flight returns a handle to the same asset. Reads go through
+    // IoQueue::Global() and loaders run on `decodePool`, so a handle comes back immediately
+    // and is polled or waited on. A path always maps to one asset type; requesting it as
+    // another is a programming error. Thread-safe. The manager must outlive every handle.
+    class AssetManager {
+    public:
+        template<typename T>
+        using LoadFunc =
+          std::function<unique_ptr<T>(std::span<const u8> bytes, AssetLoadContext& context)>;
+
+        static constexpr u32 kSlotsPerChunk = 1024;
+        static constexpr u32 kMaxChunks     = 1024;
+
+        explicit AssetManager(ThreadPool& decodePool,
+                              const AssetManagerOptions& options = AssetManagerOptions());
+        // Waits for loads in flight, then destroys every asset.
+        ~AssetManager();
+
+        AssetManager(const AssetManager&)            = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        // A loader returns None to reject its input.
+        template<typename T>
+        void RegisterLoader(LoadFunc<T> load) {
+            RegisterLoader(
+              typeid(T),
+              [load = std::move(load)](std::span<const u8> bytes, AssetLoadContext& context) {
+                  return CAST<void*>(load(bytes, context).release());
+              },
+              [](void* asset) { delete CAST<T*>(asset); });
+        }
+
+        template<typename T>
+        AssetHandle<T> Load(const Filesystem::Path& path) {
+            return AssetHandle<T>(LoadUntyped(path, typeid(T)));
+        }
+
+        // A new reference to the asset behind `id`, or an invalid handle if it was evicted.
+        template<typename T>
+        AssetHandle<T> Lock(AssetId id) {
+            return AssetHandle<T>(LockUntyped(id, typeid(T)));
+        }
+
+        void SetMemoryBudget(size_t bytes);
+        size_t GetMemoryBudget() const;
+
+        // Evicts every unreferenced asset regardless of the budget.
+        void Trim();
+
+        // Blocks until no load is in flight.
+        void WaitIdle();
+
+        AssetStats GetStats() const;
+
+    private:
+        friend class AssetRef;
+
+        static constexpr u32 kNoSlot = ~0u;
+
+        using ErasedLoad    = std::function<void*(std::span<const u8>, AssetLoadContext&)>;
+        using ErasedDestroy = void (*)(void*);
+
+        struct Loader {
+            ErasedLoad load;
+            ErasedDestroy destroy;
+        };
+
+        struct ReleasedAsset {
+            void* asset;
+            ErasedDestroy destroy;
+            size_t memorySize;
+        };
+
+        // What a locked operation let go of. Destroyed once the lock is dropped, because asset
+        // destructors and released references re-enter the manager.
+        struct Released {
+            DeferredReleaseQueue* queue;
+            vector<AssetRef> references;
+            vector<ReleasedAsset> assets;
+
+            explicit Released(DeferredReleaseQueue* releaseQueue) : queue(releaseQueue) {}
+
+            ~Released() {
+                for (const auto& [asset, destroy, memorySize] : assets) {
+                    if (queue) {
+                        queue->Release(shared_ptr<void>(asset, destroy), memorySize);
+                    } else {
+                        destroy(asset);
+                    }
+                }
+            }
+        };
+
+        struct Slot {
+            std::atomic<u32> refCount {0};
+            std::atomic<AssetState> state {AssetState::Unloaded};
+            u32 generation = 1;
+            // Written before `state` is published as Ready
+            void* asset                = None;
+            const std::type_info* type = None;
+            const Loader* loader       = None;
+            Filesystem::InternedPath path;
+            size_t memorySize = 0;
+            vector<AssetRef> dependencies;
+            vector<u32> dependents;  // Slots waiting on this one
+            u32 pendingDependencies = 0;
+            bool inLru              = false;
+            u32 lruPrev             = kNoSlot;
+            u32 lruNext             = kNoSlot;
+            u32 nextFree            = kNoSlot;
+        };
+
+        ThreadPool& _decodePool;
+        AssetManagerOptions _options;
+        unordered_map<std::type_index, unique_ptr<Loader>> _loaders;
+        unordered_map<Filesystem::InternedPath, u32> _byPath;
+
+        // Chunks never move, so handles read their slot without taking the lock
+        array<std::atomic<Slot*>, kMaxChunks> _chunks {};
+        u32 _slotCount = 0;
+        u32 _freeSlot  = kNoSlot;
+        u32 _lruHead   = kNoSlot;
+        u32 _lruTail   = kNoSlot;
+
+        size_t _memoryUsed  = 0;
+        u32 _inFlight       = 0;  // Loads not yet Ready or Failed
+        u32 _pendingDecodes = 0;  // Reads issued whose Decode hasn't returned
+        u64 _loads          = 0;
+        u64 _hits           = 0;
+        u64 _evictions      = 0;
+
+        mutable std::mutex _mutex;
+        mutable std::condition_variable _changed;
+
+        void RegisterLoader(const std::type_info& type, ErasedLoad load, ErasedDestroy destroy);
+        AssetRef LoadUntyped(const Filesystem::Path& path, const std::type_info& type);
+        AssetRef LockUntyped(AssetId id, const std::type_info& type);
+
+        Slot& GetSlot(u32 index) const;
+        u32 AllocateSlot();
+        void AddRef(u32 index);
+        void Release(u32 index);
+        AssetState GetState(u32 index) const;
+        AssetState Wait(u32 index) const;
+        const void* GetAsset(u32 index) const;
+
+        void Decode(u32 index, vector<u8> bytes);
+        bool DependsOn(u32 from, u32 target) const;
+        void AcquireLocked(u32 index);
+        void FinishLocked(u32 index, bool ok, Released& released);
+        void EvictLocked(u32 index, Released& released);
+        void FreeSlotLocked(u32 index);
+        void EnforceBudgetLocked(size_t budget, Released& released);
+        void LinkLru(u32 index);
+        void UnlinkLru(u32 index);
+    };
+
+    template<typename T>
+    AssetHandle<T> AssetLoadContext::Load(const str& path) {
+        AssetHandle<T> handle = _manager.Load<T>(Resolve(path));
+        _dependencies.push_back(handle);
+        return handle;
+    }
+}  // namespace x
@@ -0,0 +1,247 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "Assets.hpp"
+#include "LineScanner.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+namespace x {
+    namespace {
+        constexpr u32 kDdsMagic        = 0x20534444;  // "DDS "
+        constexpr u32 kDdsFourCC       = 0x4;
+        constexpr u32 kDdsRgb          = 0x40;
+        constexpr u32 kDdsCubemap      = 0x200;
+        constexpr u32 kDdsDx10CubeFlag = 0x4;
+
+        constexpr u32 MakeFourCC(char a, char b, char c, char d) {
+            return u32(u8(a)) | u32(u8(b)) << 8 | u32(u8(c)) << 16 | u32(u8(d)) << 24;
+        }
+
+        // DXGI_FORMAT values, spelled out so this compiles without the D3D headers
+        enum DxgiFormat : u32 {
+            kR8G8B8A8Unorm = 28,
+            kBc1Unorm      = 71,
+            kBc2Unorm      = 74,
+            kBc3Unorm      = 77,
+            kBc4Unorm      = 80,
+            kBc5Unorm      = 83,
+            kB8G8R8A8Unorm = 87,
+        };
+
+        struct DdsPixelFormat {
+            u32 size;
+            u32 flags;
+            u32 fourCC;
+            u32 rgbBitCount;
+            u32 rMask;
+            u32 gMask;
+            u32 bMask;
+            u32 aMask;
+        };
+
+        struct DdsHeader {
+            u32 size;
+            u32 flags;
+            u32 height;
+            u32 width;
+            u32 pitchOrLinearSize;
+            u32 depth;
+            u32 mipMapCount;
+            u32 reserved1[11];
+            DdsPixelFormat format;
+            u32 caps;
+            u32 caps2;
+            u32 caps3;
+            u32 caps4;
+            u32 reserved2;
+        };
+        static_assert(sizeof(DdsHeader) == 124);
+
+        struct DdsHeaderDx10 {
+            u32 dxgiFormat;
+            u32 resourceDimension;
+            u32 miscFlag;
+            u32 arraySize;
+            u32 miscFlags2;
+        };
+
+        u32 LegacyDxgiFormat(const DdsPixelFormat& format) {
+            if (format.flags & kDdsFourCC) {
+                switch (format.fourCC) {
+                    case MakeFourCC('D', 'X', 'T', '1'):
+                        return kBc1Unorm;
+                    case MakeFourCC('D', 'X', 'T', '3'):
+                        return kBc2Unorm;
+                    case MakeFourCC('D', 'X', 'T', '5'):
+                        return kBc3Unorm;
+                    case MakeFourCC('A', 'T', 'I', '1'):
+                    case MakeFourCC('B', 'C', '4', 'U'):
+                        return kBc4Unorm;
+                    case MakeFourCC('A', 'T', 'I', '2'):
+                    case MakeFourCC('B', 'C', '5', 'U'):
+                        return kBc5Unorm;
+                    default:
+                        return 0;
+                }
+            }
+            if ((format.flags & kDdsRgb) && format.rgbBitCount == 32) {
+                if (format.rMask == 0x000000FF) { return kR8G8B8A8Unorm; }
+                if (format.rMask == 0x00FF0000) { return kB8G8R8A8Unorm; }
+            }
+            return 0;
+        }
+
+        unique_ptr<MeshAsset>
+        LoadMesh(GraphicsDevice& device, std::span<const u8> bytes, AssetLoadContext& context) {
+            MeshFileHeader header {};
+            if (bytes.size() < sizeof(header)) { return None; }
+            memcpy(&header, bytes.data(), sizeof(header));
+            if (header.magic != kMeshMagic || header.version != kMeshVersion ||
+                header.vertexStride == 0 || header.vertexCount == 0 ||
+                header.indexFormat > CAST<u32>(IndexFormat::U32)) {
+                return None;
+            }
+
+            const auto format     = CAST<IndexFormat>(header.indexFormat);
+            const u64 vertexBytes = u64(header.vertexStride) * header.vertexCount;
+            const u64 indexBytes  = u64(header.indexCount) * (format == IndexFormat::U16 ? 2 : 4);
+            if (sizeof(header) + vertexBytes + indexBytes != bytes.size() ||
+                vertexBytes > ~0u || indexBytes > ~0u) {
+                return None;
+            }
+
+            auto mesh          = make_unique<MeshAsset>();
+            mesh->vertexStride = header.vertexStride;
+            mesh->vertexCount  = header.vertexCount;
+            mesh->indexCount   = header.indexCount;
+            mesh->indexFormat  = format;
+            mesh->vertexBuffer = device.CreateBuffer({CAST<u32>(vertexBytes),
+                                                      BufferUsage::Immutable,
+                                                      BufferBindings::Vertex,
+                                                      0,
+                                                      bytes.data() + sizeof(header)});
+            if (indexBytes > 0) {
+                mesh->indexBuffer = device.CreateBuffer({CAST<u32>(indexBytes),
+                                                         BufferUsage::Immutable,
+                                                         BufferBindings::Index,
+                                                         0,
+                                                         bytes.data() + sizeof(header) +
+                                                           vertexBytes});
+            }
+            if (!mesh->vertexBuffer || (indexBytes > 0 && !mesh->indexBuffer)) { return None; }
+            context.SetMemorySize(CAST<size_t>(vertexBytes + indexBytes));
+            return mesh;
+        }
+
+        unique_ptr<TextureAsset> LoadTexture(std::span<const u8> bytes, AssetLoadContext& context) {
+            DdsHeader header {};
+            if (bytes.size() < sizeof(u32) + sizeof(header)) { return None; }
+            u32 magic = 0;
+            memcpy(&magic, bytes.data(), sizeof(magic));
+            memcpy(&header, bytes.data() + sizeof(magic), sizeof(header));
+            if (magic != kDdsMagic || header.size != sizeof(DdsHeader) ||
+                header.format.size != sizeof(DdsPixelFormat)) {
+                return None;
+            }
+
+            auto texture      = make_unique<TextureAsset>();
+            texture->width    = header.width;
+            texture->height   = header.height;
+            texture->depth    = std::max(header.depth, 1u);
+            texture->mipCount = std::max(header.mipMapCount, 1u);
+            texture->cubemap  = (header.caps2 & kDdsCubemap) != 0;
+
+            size_t dataOffset = sizeof(magic) + sizeof(header);
+            if ((header.format.flags & kDdsFourCC) &&
+                header.format.fourCC == MakeFourCC('D', 'X', '1', '0')) {
+                DdsHeaderDx10 extended {};
+                if (bytes.size() < dataOffset + sizeof(extended)) { return None; }
+                memcpy(&extended, bytes.data() + dataOffset, sizeof(extended));
+                dataOffset += sizeof(extended);
+                texture->dxgiFormat = extended.dxgiFormat;
+                texture->arraySize  = std::max(extended.arraySize, 1u);
+                texture->cubemap |= (extended.miscFlag & kDdsDx10CubeFlag) != 0;
+            } else {
+                texture->dxgiFormat = LegacyDxgiFormat(header.format);
+            }
+            if (texture->dxgiFormat == 0 || texture->width == 0 || texture->height == 0) {
+                return None;
+            }
+
+            texture->data.assign(bytes.begin() + CAST<ptrdiff_t>(dataOffset), bytes.end());
+            context.SetMemorySize(texture->data.size());
+            return texture;
+        }
+
+        ShaderStages StageFromName(std::string_view path) {
+            if (path.ends_with(".vs.cso")) { return ShaderStages::Vertex; }
+            if (path.ends_with(".ps.cso")) { return ShaderStages::Pixel; }
+            if (path.ends_with(".cs.cso")) { return ShaderStages::Compute; }
+            return ShaderStages::None;
+        }
+
+        unique_ptr<ShaderAsset>
+        LoadShader(GraphicsDevice& device, std::span<const u8> bytes, AssetLoadContext& context) {
+            const ShaderStages stage = StageFromName(context.GetPath().Str());
+            if (stage == ShaderStages::None) { return None; }
+
+            auto shader    = make_unique<ShaderAsset>();
+            shader->stage  = stage;
+            shader->shader = device.CreateShader(stage, bytes.data(), bytes.size());
+            if (!shader->shader) { return None; }
+            return shader;
+        }
+
+        unique_ptr<SceneAsset> LoadScene(std::span<const u8> bytes, AssetLoadContext& context) {
+            auto scene = make_unique<SceneAsset>();
+            bool ok    = true;
+            Filesystem::LineScanner scanner({RCAST<const char*>(bytes.data()), bytes.size()});
+            scanner.ForEach([&](std::string_view line) {
+                const size_t start = line.find_first_not_of(" \t");
+                if (start == std::string_view::npos || line[start] == '#') { return; }
+                line = line.substr(start);
+
+                const size_t split = line.find_first_of(" \t");
+                const size_t begin = line.find_first_not_of(" \t", split);
+                if (split == std::string_view::npos || begin == std::string_view::npos) {
+                    ok = false;
+                    return;
+                }
+                const auto kind = line.substr(0, split);
+                const str path(line.substr(begin, line.find_last_not_of(" \t") + 1 - begin));
+
+                if (kind == "mesh") {
+                    scene->meshes.push_back(context.Load<MeshAsset>(path));
+                } else if (kind == "texture") {
+                    scene->textures.push_back(context.Load<TextureAsset>(path));
+                } else if (kind == "shader") {
+                    scene->shaders.push_back(context.Load<ShaderAsset>(path));
+                } else if (kind == "scene") {
+                    scene->scenes.push_back(context.Load<SceneAsset>(path));
+                } else {
+                    ok = false;
+                }
+            });
+            if (!ok) { return None; }
+            // The referenced assets account for themselves
+            context.SetMemorySize(sizeof(SceneAsset));
+            return scene;
+        }
+    }  // namespace
+
+    void RegisterBuiltinAssetLoaders(AssetManager& manager, GraphicsDevice& device) {
+        manager.RegisterLoader<MeshAsset>(
+          [&device](std::span<const u8> bytes, AssetLoadContext& context) {
+              return LoadMesh(device, bytes, context);
+          });
+        manager.RegisterLoader<TextureAsset>(LoadTexture);
+        manager.RegisterLoader<ShaderAsset>(
+          [&device](std::span<const u8> bytes, AssetLoadContext& context) {
+              return LoadShader(device, bytes, context);
+          });
+        manager.RegisterLoader<SceneAsset>(LoadScene);
+    }
+}  // namespace x
@@ -0,0 +1,76 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "AssetManager.hpp"
+#include "GraphicsDevice.hpp"
+
+namespace x {
+    // .xmesh layout: MeshFileHeader, then vertexCount * vertexStride bytes of vertices, then
+    // the indices (none when indexCount is 0). Little-endian.
+    constexpr u32 kMeshMagic   = 0x48534D58;  // "XMSH"
+    constexpr u32 kMeshVersion = 1;
+
+    struct MeshFileHeader {
+        u32 magic;
+        u32 version;
+        u32 vertexStride;
+        u32 vertexCount;
+        u32 indexCount;
+        u32 indexFormat;  // IndexFormat
+    };
+    static_assert(sizeof(MeshFileHeader) == 24);
+
+    // GPU-resident geometry.
+    struct MeshAsset {
+        shared_ptr<GraphicsBuffer> vertexBuffer;
+        shared_ptr<GraphicsBuffer> indexBuffer;  // None for non-indexed meshes
+        u32 vertexStride        = 0;
+        u32 vertexCount         = 0;
+        u32 indexCount          = 0;
+        IndexFormat indexFormat = IndexFormat::U16;
+    };
+
+    // A decoded .dds file: every mip of every slice, tightly packed in file order, ready for
+    // upload. Legacy (non-DX10) headers are mapped to their DXGI equivalents.
+    struct TextureAsset {
+        u32 width      = 0;
+        u32 height     = 0;
+        u32 depth      = 1;
+        u32 mipCount   = 1;
+        u32 arraySize  = 1;
+        u32 dxgiFormat = 0;  // DXGI_FORMAT
+        bool cubemap   = false;
+        vector<u8> data;
+    };
+
+    // Precompiled bytecode. The stage comes from the file name: Name.vs.cso, Name.ps.cso or
+    // Name.cs.cso.
+    struct ShaderAsset {
+        shared_ptr<GraphicsShader> shader;
+        ShaderStages stage = ShaderStages::None;
+    };
+
+    // .xscene is text, one reference per line, relative to the scene file:
+    //
+    //     # comment
+    //     mesh Meshes/Rock.xmesh
+    //     texture Textures/Rock.dds
+    //     shader Shaders/Lit.vs.cso
+    //     scene Prefabs/Tree.xscene
+    //
+    // Every reference loads in parallel, and the scene is Ready once all of them are.
+    struct SceneAsset {
+        vector<AssetHandle<MeshAsset>> meshes;
+        vector<AssetHandle<TextureAsset>> textures;
+        vector<AssetHandle<ShaderAsset>> shaders;
+        vector<AssetHandle<SceneAsset>> scenes;
+    };
+
+    // Registers loaders for the asset types above. `device` must outlive `manager` and create
+    // resources from the decode threads (D3D11 devices and the null device both can).
+    void RegisterBuiltinAssetLoaders(AssetManager& manager, GraphicsDevice& device);
+}  // namespace x
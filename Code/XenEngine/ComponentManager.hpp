@@ -6,24 +6,59 @@
 
 #include "Types.hpp"
 #include "EntityId.hpp"
+#include "DeferredReleaseQueue.hpp"
+#include "MemoryTracker.hpp"
+#include "PoolAllocator.hpp"
+#include "Profiler.hpp"
 
 namespace x {
     template<typename T>
     class ComponentManager {
+    public:
+        // Storage is charged to MemoryTag::Components
+        using ComponentVector = TaggedVector<T, MemoryTag::Components>;
+        using EntityVector    = TaggedVector<EntityId, MemoryTag::Components>;
+
     private:
-        vector<T> _components;
-        unordered_map<EntityId, size_t> _entityToIndex;
-        vector<EntityId> _indexToEntity;
+        ComponentVector _components;
+        // Index nodes are pooled; the bucket array is an ordinary tagged allocation
+        PooledUnorderedMap<EntityId, size_t, MemoryTag::Components> _entityToIndex;
+        EntityVector _indexToEntity;
 
     public:
         void ReleaseResources() {
             if constexpr (detail::release_resources<T>::value) {
+                X_PROFILE_SCOPE("ComponentManager::ReleaseResources");
                 for (auto& component : _components) {
                     component.Release();
                 }
             }
         }
 
+        // Hands every component to `queue`, which releases its resources once the GPU is done
+        // with them, and empties the manager.
+        void ReleaseResources(DeferredReleaseQueue& queue) {
+            if constexpr (detail::release_resources<T>::value) {
+                X_PROFILE_SCOPE("ComponentManager::ReleaseResources");
+                for (auto& component : _components) {
+                    queue.Release(make_unique<T>(std::move(component)));
+                }
+                _components.clear();
+                _entityToIndex.clear();
+                _indexToEntity.clear();
+            }
+        }
+
+        // Calls `func(EntityId, T&)` for every component, in storage order. This is the
+        // per-frame loop, so it shows up in captures as one scope per manager.
+        template<typename Func>
+        void ForEach(Func&& func) {
+            X_PROFILE_SCOPE("ComponentManager::ForEach");
+            for (size_t index = 0; index < _components.size(); ++index) {
+                func(_indexToEntity[index], _components[index]);
+            }
+        }
+
         struct ComponentView {
             EntityId entity;
             T& component;
@@ -36,12 +71,12 @@ namespace x {
 
         class Iterator {
         private:
-            vector<T>& _components;
-            vector<EntityId>& _entities;
+            ComponentVector& _components;
+            EntityVector& _entities;
             size_t _index;
 
         public:
-            Iterator(vector<T>& components, vector<EntityId>& entities, size_t index)
+            Iterator(ComponentVector& components, EntityVector& entities, size_t index)
                 : _components(components), _entities(entities), _index(index) {}
 
             ComponentView operator*() const {
@@ -64,13 +99,13 @@ namespace x {
 
         class ConstIterator {
         private:
-            const vector<T>& _components;
-            const vector<EntityId>& _entities;
+            const ComponentVector& _components;
+            const EntityVector& _entities;
             size_t _index;
 
         public:
-            ConstIterator(const vector<T>& components,
-                          const vector<EntityId>& entities,
+            ConstIterator(const ComponentVector& components,
+                          const EntityVector& entities,
                           size_t index)
                 : _components(components), _entities(entities), _index(index) {}
 
@@ -153,6 +188,16 @@ namespace x {
             }
         }
 
+        // Like RemoveComponent, but the component's resources go through `queue`.
+        void RemoveComponent(EntityId entity, DeferredReleaseQueue& queue) {
+            if constexpr (detail::release_resources<T>::value) {
+                if (T* component = GetComponentMutable(entity)) {
+                    queue.Release(make_unique<T>(std::move(*component)));
+                }
+            }
+            RemoveComponent(entity);
+        }
+
         const T* GetComponent(EntityId entity) const {
             const auto it = _entityToIndex.find(entity);
             if (it != _entityToIndex.end()) { return &_components[it->second]; }
@@ -171,7 +216,7 @@ namespace x {
             return EntityId {0};
         }
 
-        const vector<T>& GetRawComponents() const {
+        const ComponentVector& GetRawComponents() const {
             return _components;
         }
     };
@@ -4,6 +4,7 @@
 
 #include "DxBuffer.hpp"
 #include "DxGraphicsDevice.hpp"
+#include "MemoryTracker.hpp"
 #include "Panic.inl"
 
 namespace x::dx {
@@ -11,61 +12,123 @@ namespace x::dx {
         : _buffer(buffer), _device(device) {
         _buffer->GetDesc(&_description);
         _dynamic = _description.Usage == D3D11_USAGE_DYNAMIC;
+        MemoryTracker::Track(MemoryTag::Graphics, _description.ByteWidth);
     }
 
-    void DxBuffer::Update(const void* data, size_t sizeInBytes) const {
+    DxBuffer::~DxBuffer() {
+        MemoryTracker::Untrack(MemoryTag::Graphics, _description.ByteWidth);
+    }
+
+    void DxBuffer::Update(DxCommandContext& context, const void* data, size_t sizeInBytes) const {
         if (sizeInBytes > _description.ByteWidth) { Panic("Update size exceeds buffer size."); }
         if (_dynamic) {
-            UpdateDynamic(data, sizeInBytes);
+            UpdateDynamic(context, data, sizeInBytes);
         } else {
-            UpdateDefault(data);
+            UpdateDefault(context, data, sizeInBytes);
         }
     }
 
-    void DxBuffer::BindAsVertexBuffer(u32 slot, u32 stride, u32 offset) const {
+    void DxBuffer::UpdateRange(DxCommandContext& context,
+                               const void* data,
+                               size_t sizeInBytes,
+                               u32 offset,
+                               bool discard) const {
+        if (offset + sizeInBytes > _description.ByteWidth) {
+            Panic("Update range exceeds buffer size.");
+        }
+        // Constant buffers can only be written whole, and `data` may not hold that much
+        if ((_description.BindFlags & D3D11_BIND_CONSTANT_BUFFER) != 0 &&
+            (offset != 0 || sizeInBytes != _description.ByteWidth)) {
+            Panic("Constant buffers can't be partially updated.");
+        }
+        if (!_dynamic) {
+            UpdateDefault(context, data, sizeInBytes, offset);
+            return;
+        }
+
+        D3D11_MAPPED_SUBRESOURCE mappedResource;
+        const HRESULT hr = context.GetContext()->Map(
+          _buffer.Get(),
+          0,
+          discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE,
+          0,
+          &mappedResource);
+        if (FAILED(hr)) { Panic("Failed to map buffer resource."); }
+        memcpy(CAST<u8*>(mappedResource.pData) + offset, data, sizeInBytes);
+        context.GetContext()->Unmap(_buffer.Get(), 0);
+    }
+
+    void DxBuffer::BindAsVertexBuffer(DxCommandContext& context,
+                                      u32 slot,
+                                      u32 stride,
+                                      u32 offset) const {
         if ((_description.BindFlags & D3D11_BIND_VERTEX_BUFFER) == 0) {
             Panic("Buffer description has incorrect BindFlags for vertex buffer.");
         }
-        ID3D11Buffer* buffer = _buffer.Get();
-        _device.GetImmediateContext()->IASetVertexBuffers(slot, 1, &buffer, &stride, &offset);
+        context.GetStateCache().SetVertexBuffer(slot, _buffer.Get(), stride, offset);
     }
 
-    void DxBuffer::BindAsIndexBuffer(DXGI_FORMAT format, u32 offset) const {
+    void
+    DxBuffer::BindAsIndexBuffer(DxCommandContext& context, DXGI_FORMAT format, u32 offset) const {
         if ((_description.BindFlags & D3D11_BIND_INDEX_BUFFER) == 0) {
             Panic("Buffer description has incorrect BindFlags for index buffer.");
         }
-        _device.GetImmediateContext()->IASetIndexBuffer(_buffer.Get(), format, offset);
+        context.GetStateCache().SetIndexBuffer(_buffer.Get(), format, offset);
     }
 
-    void DxBuffer::BindAsConstantBuffer(u32 slot, ShaderStages stages) const {
+    void
+    DxBuffer::BindAsConstantBuffer(DxCommandContext& context, u32 slot, ShaderStages stages) const {
         if ((_description.BindFlags & D3D11_BIND_CONSTANT_BUFFER) == 0) {
             Panic("Buffer description has incorrect BindFlags for constant buffer.");
         }
-        ID3D11Buffer* buffer = _buffer.Get();
-        if (HasStage(stages, ShaderStages::Vertex)) {
-            _device.GetImmediateContext()->VSSetConstantBuffers(slot, 1, &buffer);
-        }
-        if (HasStage(stages, ShaderStages::Pixel)) {
-            _device.GetImmediateContext()->PSSetConstantBuffers(slot, 1, &buffer);
-        }
-        if (HasStage(stages, ShaderStages::Compute)) {
-            _device.GetImmediateContext()->CSSetConstantBuffers(slot, 1, &buffer);
-        }
+        context.GetStateCache().SetConstantBuffer(stages, slot, _buffer.Get());
     }
 
-    void DxBuffer::UpdateDynamic(const void* data, size_t sizeInBytes) const {
+    bool DxBuffer::SupportsBinding(BufferBindings binding) const {
+        const u32 bindFlags = ToD3D11BindFlags(binding);
+        return bindFlags != 0 && (_description.BindFlags & bindFlags) == bindFlags;
+    }
+
+    void DxBuffer::UpdateDynamic(DxCommandContext& context,
+                                 const void* data,
+                                 size_t sizeInBytes) const {
         D3D11_MAPPED_SUBRESOURCE mappedResource;
-        const HRESULT hr = _device.GetImmediateContext()->Map(_buffer.Get(),
-                                                              0,
-                                                              D3D11_MAP_WRITE_DISCARD,
-                                                              0,
-                                                              &mappedResource);
+        const HRESULT hr = context.GetContext()->Map(_buffer.Get(),
+                                                     0,
+                                                     D3D11_MAP_WRITE_DISCARD,
+                                                     0,
+                                                     &mappedResource);
         if (FAILED(hr)) { Panic("Failed to map buffer resource."); }
         memcpy(mappedResource.pData, data, sizeInBytes);
-        _device.GetImmediateContext()->Unmap(_buffer.Get(), 0);
+        context.GetContext()->Unmap(_buffer.Get(), 0);
+    }
+
+    void DxBuffer::UpdateDefault(DxCommandContext& context,
+                                 const void* data,
+                                 size_t sizeInBytes,
+                                 u32 offset) const {
+        // Constant buffers can't be partially updated, everything else only uploads the range
+        const bool whole = (offset == 0 && sizeInBytes == _description.ByteWidth) ||
+                           (_description.BindFlags & D3D11_BIND_CONSTANT_BUFFER) != 0;
+        if (whole) {
+            context.GetContext()->UpdateSubresource(_buffer.Get(), 0, None, data, 0, 0);
+            return;
+        }
+
+        const D3D11_BOX box = {offset, 0, 0, offset + CAST<u32>(sizeInBytes), 1, 1};
+        context.GetContext()->UpdateSubresource(_buffer.Get(), 0, &box, data, 0, 0);
     }
 
-    void DxBuffer::UpdateDefault(const void* data) const {
-        _device.GetImmediateContext()->UpdateSubresource(_buffer.Get(), 0, None, data, 0, 0);
+    u32 ToD3D11BindFlags(BufferBindings bindings) {
+        u32 bindFlags = 0;
+        if (HasBinding(bindings, BufferBindings::Vertex)) bindFlags |= D3D11_BIND_VERTEX_BUFFER;
+        if (HasBinding(bindings, BufferBindings::Index)) bindFlags |= D3D11_BIND_INDEX_BUFFER;
+        if (HasBinding(bindings, BufferBindings::Constant)) {
+            bindFlags |= D3D11_BIND_CONSTANT_BUFFER;
+        }
+        if (HasBinding(bindings, BufferBindings::ShaderResource)) {
+            bindFlags |= D3D11_BIND_SHADER_RESOURCE;
+        }
+        return bindFlags;
     }
-}  // namespace x::dx
\ No newline at end of file
+}  // namespace x::dx
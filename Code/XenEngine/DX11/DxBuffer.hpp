@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Types.hpp"
+#include "GraphicsDevice.hpp"
 #include <d3d11.h>
 #include <wrl/client.h>
 
@@ -13,27 +14,11 @@ namespace x::dx {
 
     // Forward declaration
     class DxGraphicsDevice;
+    class DxCommandContext;
 
-    enum class ShaderStages : u32 {
-        None    = 0,
-        Vertex  = 1 << 0,
-        Pixel   = 1 << 1,
-        Compute = 1 << 2,
-    };
-
-    inline ShaderStages operator|(ShaderStages a, ShaderStages b) {
-        return CAST<ShaderStages>(CAST<u32>(a) | CAST<u32>(b));
-    }
-
-    inline ShaderStages operator&(ShaderStages a, ShaderStages b) {
-        return CAST<ShaderStages>(CAST<u32>(a) & CAST<u32>(b));
-    }
-
-    inline bool HasStage(ShaderStages stages, ShaderStages stage) {
-        return (CAST<u32>(stages) & CAST<u32>(stage)) != 0;
-    }
+    u32 ToD3D11BindFlags(BufferBindings bindings);
 
-    class DxBuffer {
+    class DxBuffer final : public GraphicsBuffer {
     private:
         ComPtr<ID3D11Buffer> _buffer;
         DxGraphicsDevice& _device;
@@ -42,21 +27,35 @@ namespace x::dx {
 
     public:
         DxBuffer(const ComPtr<ID3D11Buffer>& buffer, DxGraphicsDevice& device);
+        ~DxBuffer() override;
 
         DxBuffer(const DxBuffer&)            = delete;
         DxBuffer& operator=(const DxBuffer&) = delete;
 
-        void Update(const void* data, size_t sizeInBytes) const;
-        void BindAsVertexBuffer(u32 slot, u32 stride, u32 offset = 0) const;
-        void BindAsIndexBuffer(DXGI_FORMAT format, u32 offset = 0) const;
-        void BindAsConstantBuffer(u32 slot, ShaderStages stages) const;
+        // All updates and binds are recorded into the given context, which may be deferred.
+        void Update(DxCommandContext& context, const void* data, size_t sizeInBytes) const;
+        // Writes `sizeInBytes` at `offset` without touching the rest of the buffer. Dynamic
+        // buffers map with NO_OVERWRITE unless `discard` is set; the caller guarantees the GPU
+        // is not reading the range. Deferred contexts only support discarding maps.
+        void UpdateRange(DxCommandContext& context,
+                         const void* data,
+                         size_t sizeInBytes,
+                         u32 offset,
+                         bool discard) const;
+        void BindAsVertexBuffer(DxCommandContext& context,
+                                u32 slot,
+                                u32 stride,
+                                u32 offset = 0) const;
+        void BindAsIndexBuffer(DxCommandContext& context, DXGI_FORMAT format, u32 offset = 0) const;
+        void BindAsConstantBuffer(DxCommandContext& context, u32 slot, ShaderStages stages) const;
 
-        u32 GetSize() const {
+        u32 GetSize() const override {
             return _description.ByteWidth;
         }
-        bool IsDynamic() const {
+        bool IsDynamic() const override {
             return _dynamic;
         }
+        bool SupportsBinding(BufferBindings binding) const override;
         ID3D11Buffer* GetRawBuffer() const {
             return _buffer.Get();
         }
@@ -65,7 +64,10 @@ namespace x::dx {
         }
 
     private:
-        void UpdateDynamic(const void* data, size_t sizeInBytes) const;
-        void UpdateDefault(const void* data) const;
+        void UpdateDynamic(DxCommandContext& context, const void* data, size_t sizeInBytes) const;
+        void UpdateDefault(DxCommandContext& context,
+                           const void* data,
+                           size_t sizeInBytes,
+                           u32 offset = 0) const;
     };
 }  // namespace x::dx
@@ -0,0 +1,113 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "DxCommandContext.hpp"
+#include "DxGraphicsDevice.hpp"
+#include "DxBuffer.hpp"
+#include "DxShader.hpp"
+#include "Panic.inl"
+
+namespace x::dx {
+    DxCommandContext::DxCommandContext(const ComPtr<ID3D11DeviceContext>& context)
+        : _context(context), _stateCache(context.Get()),
+          _deferred(context->GetType() == D3D11_DEVICE_CONTEXT_DEFERRED) {}
+
+    void DxCommandContext::UpdateBuffer(GraphicsBuffer& buffer,
+                                        const void* data,
+                                        size_t sizeInBytes) {
+        CAST<DxBuffer&>(buffer).Update(*this, data, sizeInBytes);
+    }
+
+    void DxCommandContext::UpdateBufferRange(GraphicsBuffer& buffer,
+                                             const void* data,
+                                             size_t sizeInBytes,
+                                             u32 offset,
+                                             bool discard) {
+        CAST<DxBuffer&>(buffer).UpdateRange(*this, data, sizeInBytes, offset, discard);
+    }
+
+    void
+    DxCommandContext::BindVertexBuffer(u32 slot, GraphicsBuffer& buffer, u32 stride, u32 offset) {
+        CAST<DxBuffer&>(buffer).BindAsVertexBuffer(*this, slot, stride, offset);
+    }
+
+    void
+    DxCommandContext::BindIndexBuffer(GraphicsBuffer& buffer, IndexFormat format, u32 offset) {
+        const DXGI_FORMAT dxgiFormat =
+          format == IndexFormat::U16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+        CAST<DxBuffer&>(buffer).BindAsIndexBuffer(*this, dxgiFormat, offset);
+    }
+
+    void
+    DxCommandContext::BindConstantBuffer(u32 slot, ShaderStages stages, GraphicsBuffer& buffer) {
+        CAST<DxBuffer&>(buffer).BindAsConstantBuffer(*this, slot, stages);
+    }
+
+    void DxCommandContext::BindShader(const GraphicsShader& shader) {
+        CAST<const DxShader&>(shader).Bind(*this);
+    }
+
+    void DxCommandContext::Draw(u32 vertexCount, u32 startVertex) {
+        _stateCache.Flush();
+        _context->Draw(vertexCount, startVertex);
+    }
+
+    void DxCommandContext::DrawIndexed(u32 indexCount, u32 startIndex, i32 baseVertex) {
+        _stateCache.Flush();
+        _context->DrawIndexed(indexCount, startIndex, baseVertex);
+    }
+
+    void DxCommandContext::DrawIndexedInstanced(u32 indexCountPerInstance,
+                                                u32 instanceCount,
+                                                u32 startIndex,
+                                                i32 baseVertex,
+                                                u32 startInstance) {
+        _stateCache.Flush();
+        _context->DrawIndexedInstanced(indexCountPerInstance,
+                                       instanceCount,
+                                       startIndex,
+                                       baseVertex,
+                                       startInstance);
+    }
+
+    unique_ptr<CommandList> DxCommandContext::Finish() {
+        return make_unique<DxCommandList>(FinishCommandList());
+    }
+
+    void DxCommandContext::Execute(CommandList& commandList) {
+        ExecuteCommandList(CAST<DxCommandList&>(commandList).GetRawCommandList());
+    }
+
+    ComPtr<ID3D11CommandList> DxCommandContext::FinishCommandList() {
+        if (!_deferred) { Panic("Finish called on the immediate context."); }
+        ComPtr<ID3D11CommandList> commandList;
+        if (FAILED(_context->FinishCommandList(FALSE, &commandList))) {
+            Panic("Failed to finish command list.");
+        }
+        _stateCache.Reset();
+        return commandList;
+    }
+
+    void DxCommandContext::ExecuteCommandList(ID3D11CommandList* commandList) {
+        if (_deferred) { Panic("Command lists must be executed on the immediate context."); }
+        _context->ExecuteCommandList(commandList, FALSE);
+        _stateCache.Reset();
+    }
+
+    void DxCommandContext::BeginFrame() {
+        _stateCache.BeginFrame();
+    }
+
+    unique_ptr<DxCommandContext> DxRecordingBackend::CreateContext() {
+        return _device.CreateDeferredContext();
+    }
+
+    DxRecordingBackend::CommandList DxRecordingBackend::Finish(Context& context) {
+        return context.FinishCommandList();
+    }
+
+    void DxRecordingBackend::Execute(CommandList& commandList) {
+        _device.GetImmediateContext().ExecuteCommandList(commandList.Get());
+    }
+}  // namespace x::dx
@@ -0,0 +1,110 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "GraphicsDevice.hpp"
+#include "DxStateCache.hpp"
+#include <d3d11.h>
+#include <wrl/client.h>
+
+namespace x::dx {
+    using Microsoft::WRL::ComPtr;
+
+    class DxGraphicsDevice;
+
+    class DxCommandList final : public CommandList {
+    public:
+        explicit DxCommandList(const ComPtr<ID3D11CommandList>& commandList)
+            : _commandList(commandList) {}
+
+        ID3D11CommandList* GetRawCommandList() const {
+            return _commandList.Get();
+        }
+
+    private:
+        ComPtr<ID3D11CommandList> _commandList;
+    };
+
+    // A device context plus the binding cache for it. The immediate context is owned by the
+    // DxGraphicsDevice; deferred contexts are created per recording thread and turned into
+    // command lists with Finish(), which the immediate context then executes.
+    class DxCommandContext final : public CommandContext {
+    public:
+        explicit DxCommandContext(const ComPtr<ID3D11DeviceContext>& context);
+
+        DxCommandContext(const DxCommandContext&)            = delete;
+        DxCommandContext& operator=(const DxCommandContext&) = delete;
+
+        // Portable entry points; buffers and shaders must have been created by a
+        // DxGraphicsDevice.
+        void UpdateBuffer(GraphicsBuffer& buffer, const void* data, size_t sizeInBytes) override;
+        void UpdateBufferRange(GraphicsBuffer& buffer,
+                               const void* data,
+                               size_t sizeInBytes,
+                               u32 offset,
+                               bool discard) override;
+        void BindVertexBuffer(u32 slot, GraphicsBuffer& buffer, u32 stride, u32 offset) override;
+        void BindIndexBuffer(GraphicsBuffer& buffer, IndexFormat format, u32 offset) override;
+        void BindConstantBuffer(u32 slot, ShaderStages stages, GraphicsBuffer& buffer) override;
+        void BindShader(const GraphicsShader& shader) override;
+
+        void Draw(u32 vertexCount, u32 startVertex) override;
+        void DrawIndexed(u32 indexCount, u32 startIndex, i32 baseVertex) override;
+        void DrawIndexedInstanced(u32 indexCountPerInstance,
+                                  u32 instanceCount,
+                                  u32 startIndex,
+                                  i32 baseVertex,
+                                  u32 startInstance) override;
+
+        unique_ptr<CommandList> Finish() override;
+        void Execute(CommandList& commandList) override;
+
+        // Deferred contexts only. Closes the recording and resets the context's state.
+        ComPtr<ID3D11CommandList> FinishCommandList();
+
+        // Immediate context only. State is cleared after execution, as with ClearState.
+        void ExecuteCommandList(ID3D11CommandList* commandList);
+
+        void BeginFrame();
+
+        bool IsDeferred() const {
+            return _deferred;
+        }
+
+        ID3D11DeviceContext* GetContext() const {
+            return _context.Get();
+        }
+
+        DxStateCache& GetStateCache() {
+            return _stateCache;
+        }
+
+        const DxStateCache& GetStateCache() const {
+            return _stateCache;
+        }
+
+    private:
+        ComPtr<ID3D11DeviceContext> _context;
+        DxStateCache _stateCache;
+        bool _deferred;
+    };
+
+    // ParallelRecorder backend recording into D3D11 deferred contexts.
+    class DxRecordingBackend {
+    public:
+        using Context     = DxCommandContext;
+        using CommandList = ComPtr<ID3D11CommandList>;
+
+        explicit DxRecordingBackend(DxGraphicsDevice& device) : _device(device) {}
+
+        unique_ptr<Context> CreateContext();
+        CommandList Finish(Context& context);
+        void Execute(CommandList& commandList);
+
+    private:
+        DxGraphicsDevice& _device;
+    };
+}  // namespace x::dx
@@ -0,0 +1,188 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "DxGeometryHeap.hpp"
+#include "Panic.inl"
+
+#include <algorithm>
+
+namespace x::dx {
+    DxGeometryHeap::DxGeometryHeap(DxGraphicsDevice& device,
+                                   u32 vertexStride,
+                                   u32 verticesPerPage,
+                                   u32 indicesPerPage)
+        : _device(device), _vertexStride(vertexStride), _verticesPerPage(verticesPerPage),
+          _indicesPerPage(indicesPerPage) {}
+
+    DxGeometryHeap::Handle DxGeometryHeap::Allocate(const void* vertices,
+                                                    u32 vertexCount,
+                                                    const u32* indices,
+                                                    u32 indexCount) {
+        if (vertexCount == 0) return kInvalidHandle;
+
+        if (++_generation == 0) { _generation = 1; }
+        Allocation allocation {0,
+                               TlsfAllocator::kInvalidHandle,
+                               TlsfAllocator::kInvalidHandle,
+                               _generation};
+        Page* page = None;
+        for (u32 i = 0; i < _pages.size(); ++i) {
+            auto& candidate = *_pages[i];
+            const auto v    = candidate.vertices.Allocate(vertexCount);
+            if (v == TlsfAllocator::kInvalidHandle) continue;
+            if (indexCount > 0) {
+                const auto idx = candidate.indices.Allocate(indexCount);
+                if (idx == TlsfAllocator::kInvalidHandle) {
+                    candidate.vertices.Free(v);
+                    continue;
+                }
+                allocation.indices = idx;
+            }
+            allocation.page     = i;
+            allocation.vertices = v;
+            page                = &candidate;
+            break;
+        }
+
+        if (!page) {
+            // Meshes larger than the page size get a dedicated page
+            page = &CreatePage(std::max(_verticesPerPage, vertexCount),
+                               std::max(_indicesPerPage, indexCount));
+            allocation.page     = CAST<u32>(_pages.size() - 1);
+            allocation.vertices = page->vertices.Allocate(vertexCount);
+            if (indexCount > 0) { allocation.indices = page->indices.Allocate(indexCount); }
+        }
+
+        auto& context = _device.GetImmediateContext();
+        page->vertexBuffer->UpdateRange(context,
+                                        vertices,
+                                        CAST<size_t>(vertexCount) * _vertexStride,
+                                        page->vertices.GetOffset(allocation.vertices) *
+                                          _vertexStride,
+                                        false);
+        if (indexCount > 0) {
+            page->indexBuffer->UpdateRange(context,
+                                           indices,
+                                           CAST<size_t>(indexCount) * sizeof(u32),
+                                           page->indices.GetOffset(allocation.indices) *
+                                             CAST<u32>(sizeof(u32)),
+                                           false);
+        }
+
+        u32 slot;
+        if (!_freeSlots.empty()) {
+            slot = _freeSlots.back();
+            _freeSlots.pop_back();
+            _allocations[slot] = allocation;
+        } else {
+            slot = CAST<u32>(_allocations.size());
+            _allocations.push_back(allocation);
+        }
+        return (CAST<Handle>(allocation.generation) << 32) | slot;
+    }
+
+    void DxGeometryHeap::Free(Handle handle) {
+        const u32 slot = Resolve(handle);
+        if (slot == kNoAllocation) return;
+
+        auto& allocation = _allocations[slot];
+        auto& page       = *_pages[allocation.page];
+        page.vertices.Free(allocation.vertices);
+        page.indices.Free(allocation.indices);
+        allocation.generation = 0;
+        _freeSlots.push_back(slot);
+    }
+
+    DxGeometryHeap::DrawArgs DxGeometryHeap::GetDrawArgs(Handle handle) const {
+        const u32 slot = Resolve(handle);
+        if (slot == kNoAllocation) {
+            Panic("Invalid or stale geometry handle %llx", CAST<unsigned long long>(handle));
+        }
+
+        const auto& allocation = _allocations[slot];
+        const auto& page       = *_pages[allocation.page];
+
+        DrawArgs args;
+        args.page       = allocation.page;
+        args.baseVertex = CAST<i32>(page.vertices.GetOffset(allocation.vertices));
+        args.startIndex = 0;
+        args.indexCount = 0;
+        if (allocation.indices != TlsfAllocator::kInvalidHandle) {
+            args.startIndex = page.indices.GetOffset(allocation.indices);
+            args.indexCount = page.indices.GetSize(allocation.indices);
+        }
+        return args;
+    }
+
+    void DxGeometryHeap::Bind(DxCommandContext& context, u32 page, u32 slot) const {
+        _pages[page]->vertexBuffer->BindAsVertexBuffer(context, slot, _vertexStride);
+        _pages[page]->indexBuffer->BindAsIndexBuffer(context, DXGI_FORMAT_R32_UINT);
+    }
+
+    void DxGeometryHeap::Defragment() {
+        for (const auto& page : _pages) {
+            CompactBuffer(page->vertexBuffer, page->vertices.Defragment(), _vertexStride);
+            CompactBuffer(page->indexBuffer, page->indices.Defragment(), sizeof(u32));
+        }
+    }
+
+    u32 DxGeometryHeap::Resolve(Handle handle) const {
+        const u32 slot       = CAST<u32>(handle);
+        const u32 generation = CAST<u32>(handle >> 32);
+        if (generation == 0 || slot >= _allocations.size()) return kNoAllocation;
+        return _allocations[slot].generation == generation ? slot : kNoAllocation;
+    }
+
+    DxGeometryHeap::Page& DxGeometryHeap::CreatePage(u32 vertexCapacity, u32 indexCapacity) {
+        auto page = make_unique<Page>(Page {
+          _device.CreateVertexBuffer(None, vertexCapacity * _vertexStride),
+          _device.CreateIndexBuffer(None, indexCapacity * CAST<u32>(sizeof(u32))),
+          TlsfAllocator(vertexCapacity),
+          TlsfAllocator(indexCapacity),
+        });
+        _pages.push_back(std::move(page));
+        return *_pages.back();
+    }
+
+    void DxGeometryHeap::CompactBuffer(const shared_ptr<DxBuffer>& buffer,
+                                       const vector<TlsfAllocator::Move>& moves,
+                                       u32 elementSize) const {
+        if (moves.empty()) return;
+
+        // Copies within a single resource may not overlap, so snapshot the buffer first and
+        // copy each moved range back from the snapshot
+        BufferDescription desc;
+        desc.sizeInBytes = buffer->GetSize();
+        desc.usage       = D3D11_USAGE_DEFAULT;
+        desc.bindFlags   = D3D11_BIND_VERTEX_BUFFER;
+
+        const auto snapshot = _device.CreateBuffer(desc);
+
+        auto* context = _device.GetImmediateContext().GetContext();
+        context->CopySubresourceRegion(snapshot->GetRawBuffer(),
+                                       0,
+                                       0,
+                                       0,
+                                       0,
+                                       buffer->GetRawBuffer(),
+                                       0,
+                                       None);
+        for (const auto& move : moves) {
+            const D3D11_BOX box = {move.srcOffset * elementSize,
+                                   0,
+                                   0,
+                                   (move.srcOffset + move.size) * elementSize,
+                                   1,
+                                   1};
+            context->CopySubresourceRegion(buffer->GetRawBuffer(),
+                                           0,
+                                           move.dstOffset * elementSize,
+                                           0,
+                                           0,
+                                           snapshot->GetRawBuffer(),
+                                           0,
+                                           &box);
+        }
+    }
+}  // namespace x::dx
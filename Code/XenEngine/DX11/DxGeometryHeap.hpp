@@ -0,0 +1,97 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "TlsfAllocator.hpp"
+#include "DxGraphicsDevice.hpp"
+
+namespace x::dx {
+    // Pooled storage for long-lived mesh data. Vertices and indices are suballocated from a
+    // few large buffers ("pages") by TLSF allocators working in vertex/index units, so meshes
+    // on the same page share one vertex and index buffer binding and draws only differ by
+    // base vertex and start index. Indices are 32-bit and relative to the mesh's first vertex.
+    // Uploads and compaction always run on the immediate context. Handles carry a generation,
+    // like the TLSF handles behind them, so a freed handle stays invalid when its slot is reused.
+    class DxGeometryHeap {
+    public:
+        using Handle                           = u64;
+        static constexpr Handle kInvalidHandle = ~0ull;
+
+        struct DrawArgs {
+            u32 page;
+            i32 baseVertex;
+            u32 startIndex;
+            u32 indexCount;
+        };
+
+        DxGeometryHeap(DxGraphicsDevice& device,
+                       u32 vertexStride,
+                       u32 verticesPerPage = 1u << 20,
+                       u32 indicesPerPage  = 3u << 20);
+
+        DxGeometryHeap(const DxGeometryHeap&)            = delete;
+        DxGeometryHeap& operator=(const DxGeometryHeap&) = delete;
+
+        Handle
+        Allocate(const void* vertices, u32 vertexCount, const u32* indices, u32 indexCount);
+        // Ignores invalid, stale and already freed handles.
+        void Free(Handle handle);
+
+        bool IsValid(Handle handle) const {
+            return Resolve(handle) != kNoAllocation;
+        }
+
+        // Panics on a handle that isn't valid.
+        DrawArgs GetDrawArgs(Handle handle) const;
+
+        // Binds the page's vertex buffer to `slot` and its index buffer.
+        void Bind(DxCommandContext& context, u32 page, u32 slot = 0) const;
+
+        // Compacts every page on the GPU. Handles remain valid; draw args must be re-queried.
+        void Defragment();
+
+        u32 GetPageCount() const {
+            return CAST<u32>(_pages.size());
+        }
+
+        u32 GetVertexStride() const {
+            return _vertexStride;
+        }
+
+    private:
+        static constexpr u32 kNoAllocation = ~0u;
+
+        struct Page {
+            shared_ptr<DxBuffer> vertexBuffer;
+            shared_ptr<DxBuffer> indexBuffer;
+            TlsfAllocator vertices;
+            TlsfAllocator indices;
+        };
+
+        struct Allocation {
+            u32 page;
+            TlsfAllocator::Handle vertices;
+            TlsfAllocator::Handle indices;
+            u32 generation;  // 0 once freed
+        };
+
+        DxGraphicsDevice& _device;
+        u32 _vertexStride;
+        u32 _verticesPerPage;
+        u32 _indicesPerPage;
+        vector<unique_ptr<Page>> _pages;
+        vector<Allocation> _allocations;
+        vector<u32> _freeSlots;
+        u32 _generation = 0;
+
+        u32 Resolve(Handle handle) const;
+
+        Page& CreatePage(u32 vertexCapacity, u32 indexCapacity);
+        void CompactBuffer(const shared_ptr<DxBuffer>& buffer,
+                           const vector<TlsfAllocator::Move>& moves,
+                           u32 elementSize) const;
+    };
+}  // namespace x::dx
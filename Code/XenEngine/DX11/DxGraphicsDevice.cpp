@@ -3,6 +3,7 @@
 //
 
 #include "DxGraphicsDevice.hpp"
+#include "DxShader.hpp"
 
 #include "Panic.inl"
 
@@ -18,6 +19,56 @@ namespace x::dx {
         }
     }
 
+    shared_ptr<GraphicsBuffer>
+    DxGraphicsDevice::CreateBuffer(const GraphicsBufferDescription& desc) {
+        BufferDescription bd;
+        bd.sizeInBytes         = desc.sizeInBytes;
+        bd.bindFlags           = ToD3D11BindFlags(desc.bindings);
+        bd.structureByteStride = desc.structureByteStride;
+        bd.initialData         = desc.initialData;
+        switch (desc.usage) {
+            case BufferUsage::Default:
+                bd.usage = D3D11_USAGE_DEFAULT;
+                break;
+            case BufferUsage::Immutable:
+                bd.usage = D3D11_USAGE_IMMUTABLE;
+                break;
+            case BufferUsage::Dynamic:
+                bd.usage          = D3D11_USAGE_DYNAMIC;
+                bd.cpuAccessFlags = D3D11_CPU_ACCESS_WRITE;
+                break;
+        }
+        if (desc.structureByteStride > 0) {
+            bd.miscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+        }
+
+        return CreateBuffer(bd);
+    }
+
+    shared_ptr<GraphicsShader>
+    DxGraphicsDevice::CreateShader(ShaderStages stage, const void* bytecode, size_t sizeInBytes) {
+        shared_ptr<DxShader> shader;
+        switch (stage) {
+            case ShaderStages::Vertex:
+                shader = make_shared<DxVertexShader>(*this);
+                break;
+            case ShaderStages::Pixel:
+                shader = make_shared<DxPixelShader>(*this);
+                break;
+            case ShaderStages::Compute:
+                shader = make_shared<DxComputeShader>(*this);
+                break;
+            default:
+                Panic("CreateShader requires exactly one shader stage");
+        }
+        shader->LoadFromBytecode(bytecode, sizeInBytes);
+        return shader;
+    }
+
+    unique_ptr<CommandContext> DxGraphicsDevice::CreateCommandContext() {
+        return CreateDeferredContext();
+    }
+
     shared_ptr<DxBuffer> DxGraphicsDevice::CreateBuffer(const BufferDescription& desc) {
         D3D11_BUFFER_DESC bd;
         bd.ByteWidth           = desc.sizeInBytes;
@@ -66,6 +117,18 @@ namespace x::dx {
         return CreateBuffer(desc);
     }
 
+    unique_ptr<DxCommandContext> DxGraphicsDevice::CreateDeferredContext() {
+        ComPtr<ID3D11DeviceContext> context;
+        if (FAILED(_device->CreateDeferredContext(0, &context))) {
+            Panic("Failed to create deferred context");
+        }
+        return make_unique<DxCommandContext>(context);
+    }
+
+    void DxGraphicsDevice::BeginFrame() {
+        _immediateContext->BeginFrame();
+    }
+
     void DxGraphicsDevice::Initialize() {
         CreateDeviceAndContext();
         if (kEnableDebugLayer) { SetupDebugLayer(); }
@@ -97,7 +160,7 @@ namespace x::dx {
         if (FAILED(hr)) { Panic("Failed to create D3D11 device"); }
 
         _device           = tempDevice;
-        _immediateContext = tempContext;
+        _immediateContext = make_unique<DxCommandContext>(tempContext);
     }
 
     void DxGraphicsDevice::SetupDebugLayer() {
@@ -5,10 +5,16 @@
 #pragma once
 
 #include "Types.hpp"
+#include "GraphicsDevice.hpp"
 #include "DxBuffer.hpp"
+#include "DxCommandContext.hpp"
 #include <d3d11.h>
 #include <wrl/client.h>
 
+namespace x {
+    class ShaderCache;
+}
+
 namespace x::dx {
     using Microsoft::WRL::ComPtr;
 
@@ -32,37 +38,60 @@ namespace x::dx {
         const void* initialData = None;
     };
 
-    class DxGraphicsDevice {
+    class DxGraphicsDevice final : public GraphicsDevice {
     private:
         ComPtr<ID3D11Device> _device;
-        ComPtr<ID3D11DeviceContext> _immediateContext;
+        unique_ptr<DxCommandContext> _immediateContext;
         ComPtr<ID3D11Debug> _debugDevice;
+        shared_ptr<ShaderCache> _shaderCache;
 
     public:
         DxGraphicsDevice();
-        ~DxGraphicsDevice();
+        ~DxGraphicsDevice() override;
 
         // Remove copy
         DxGraphicsDevice(const DxGraphicsDevice&)            = delete;
         DxGraphicsDevice& operator=(const DxGraphicsDevice&) = delete;
 
+        shared_ptr<GraphicsBuffer> CreateBuffer(const GraphicsBufferDescription& desc) override;
+        shared_ptr<GraphicsShader>
+        CreateShader(ShaderStages stage, const void* bytecode, size_t sizeInBytes) override;
+        unique_ptr<CommandContext> CreateCommandContext() override;
+
         shared_ptr<DxBuffer> CreateBuffer(const BufferDescription&);
         shared_ptr<DxBuffer>
         CreateVertexBuffer(const void* data, u32 sizeInBytes, bool dynamic = false);
         shared_ptr<DxBuffer>
         CreateIndexBuffer(const void* data, u32 sizeInBytes, bool dynamic = false);
 
+        // Deferred contexts record on worker threads; see ParallelRecorder.
+        unique_ptr<DxCommandContext> CreateDeferredContext();
+
+        // Shaders loaded from files go through the cache when one is set.
+        void SetShaderCache(const shared_ptr<ShaderCache>& cache) {
+            _shaderCache = cache;
+        }
+
+        // Resets per-frame binding statistics.
+        void BeginFrame() override;
+
     private:
         void Initialize();
         void CreateDeviceAndContext();
         void SetupDebugLayer();
 
     public:
+        ShaderCache* GetShaderCache() const {
+            return _shaderCache.get();
+        }
         ID3D11Device* GetDevice() const {
             return _device.Get();
         }
-        ID3D11DeviceContext* GetImmediateContext() const {
-            return _immediateContext.Get();
+        DxCommandContext& GetImmediateContext() override {
+            return *_immediateContext;
+        }
+        const DxStateCache::Stats& GetBindingStats() const {
+            return _immediateContext->GetStateCache().GetLastFrameStats();
         }
     };
 }  // namespace x::dx
@@ -0,0 +1,54 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "DxInstanceBuffer.hpp"
+#include "Panic.inl"
+
+#include <algorithm>
+
+namespace x::dx {
+    DxInstanceBuffer::DxInstanceBuffer(DxGraphicsDevice& device, u32 initialCapacity)
+        : _device(device), _capacity(std::clamp<u32>(initialCapacity, 1, kMaxCapacity)) {
+        _buffer = _device.CreateVertexBuffer(None, _capacity * kStride, true);
+    }
+
+    void DxInstanceBuffer::Upload(DxCommandContext& context,
+                                  const vector<InstanceData>& instances) {
+        if (instances.empty()) return;
+
+        const auto count = CAST<u32>(instances.size());
+        if (count > _capacity) {
+            if (count > kMaxCapacity) {
+                Panic("Instance buffer can't hold %u instances (limit %u).", count, kMaxCapacity);
+            }
+            while (_capacity < count) {
+                _capacity = _capacity > kMaxCapacity / 2 ? kMaxCapacity : _capacity * 2;
+            }
+            _buffer = _device.CreateVertexBuffer(None, _capacity * kStride, true);
+        }
+
+        _buffer->Update(context, instances.data(), instances.size() * kStride);
+    }
+
+    void DxInstanceBuffer::Bind(DxCommandContext& context, u32 slot) const {
+        _buffer->BindAsVertexBuffer(context, slot, kStride);
+    }
+
+    void DxInstanceBuffer::Draw(DxCommandContext& context,
+                                const vector<InstanceBatch>& batches,
+                                u32 slot,
+                                const BindBatchFunc& bindBatch) const {
+        if (batches.empty()) return;
+
+        Bind(context, slot);
+        for (const auto& batch : batches) {
+            const DrawArgs args = bindBatch(batch);
+            context.DrawIndexedInstanced(args.indexCount,
+                                         batch.instanceCount,
+                                         args.startIndex,
+                                         args.baseVertex,
+                                         batch.firstInstance);
+        }
+    }
+}  // namespace x::dx
@@ -0,0 +1,54 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "DxGraphicsDevice.hpp"
+#include "InstanceBatcher.hpp"
+#include <functional>
+
+namespace x::dx {
+    // Dynamic vertex buffer holding the packed per-instance stream produced by the
+    // InstanceBatcher. Grows geometrically when a frame submits more instances than fit.
+    class DxInstanceBuffer {
+    public:
+        static constexpr u32 kStride      = sizeof(InstanceData);
+        static constexpr u32 kMaxCapacity = ~0u / kStride;
+
+        // Where a batch's mesh sits in the bound index and vertex buffers. Meshes pooled in a
+        // DxGeometryHeap live at non-zero offsets; pass its DrawArgs fields straight through.
+        struct DrawArgs {
+            u32 indexCount;
+            u32 startIndex;
+            i32 baseVertex;
+        };
+
+        // Binds mesh and material state for a batch and returns where its mesh is drawn from.
+        using BindBatchFunc = std::function<DrawArgs(const InstanceBatch&)>;
+
+        explicit DxInstanceBuffer(DxGraphicsDevice& device, u32 initialCapacity = 1024);
+
+        DxInstanceBuffer(const DxInstanceBuffer&)            = delete;
+        DxInstanceBuffer& operator=(const DxInstanceBuffer&) = delete;
+
+        void Upload(DxCommandContext& context, const vector<InstanceData>& instances);
+        void Bind(DxCommandContext& context, u32 slot) const;
+
+        // Binds the instance stream to `slot` and issues one instanced draw per batch.
+        void Draw(DxCommandContext& context,
+                  const vector<InstanceBatch>& batches,
+                  u32 slot,
+                  const BindBatchFunc& bindBatch) const;
+
+        u32 GetCapacity() const {
+            return _capacity;
+        }
+
+    private:
+        DxGraphicsDevice& _device;
+        shared_ptr<DxBuffer> _buffer;
+        u32 _capacity;
+    };
+}  // namespace x::dx
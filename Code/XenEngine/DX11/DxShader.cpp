@@ -5,34 +5,172 @@
 #include "DxShader.hpp"
 #include "Panic.inl"
 
+#include <filesystem>
+
 namespace x::dx {
-    void
-    DxShader::InitializeFromFile(const wstr& filename, const str& entryPoint, const str& target) {
+    namespace {
+        // Matches the flags the engine has always compiled with; part of the cache key.
+        constexpr u32 kCompileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+
+        void ReflectParameters(ID3D11ShaderReflection* reflector,
+                               u32 count,
+                               bool inputs,
+                               vector<ShaderReflection::Parameter>& parameters) {
+            parameters.resize(count);
+            for (u32 i = 0; i < count; ++i) {
+                D3D11_SIGNATURE_PARAMETER_DESC desc {};
+                const HRESULT hr = inputs ? reflector->GetInputParameterDesc(i, &desc)
+                                          : reflector->GetOutputParameterDesc(i, &desc);
+                if (FAILED(hr)) { Panic("Failed to reflect shader signature"); }
+                parameters[i] = {desc.SemanticName,
+                                 desc.SemanticIndex,
+                                 desc.Register,
+                                 CAST<u32>(desc.ComponentType),
+                                 desc.Mask};
+            }
+        }
+
+        ShaderReflection Reflect(const void* bytecode, size_t sizeInBytes) {
+            ComPtr<ID3D11ShaderReflection> reflector;
+            if (FAILED(D3DReflect(bytecode, sizeInBytes, IID_ID3D11ShaderReflection, &reflector))) {
+                Panic("Failed to retrieve shader reflection");
+            }
+            D3D11_SHADER_DESC shaderDesc {};
+            std::ignore = reflector->GetDesc(&shaderDesc);
+
+            ShaderReflection reflection;
+            reflection.instructionCount = shaderDesc.InstructionCount;
+            for (u32 i = 0; i < shaderDesc.ConstantBuffers; ++i) {
+                D3D11_SHADER_BUFFER_DESC desc {};
+                std::ignore = reflector->GetConstantBufferByIndex(i)->GetDesc(&desc);
+                reflection.constantBuffers.push_back({desc.Name, desc.Size, desc.Variables});
+            }
+            for (u32 i = 0; i < shaderDesc.BoundResources; ++i) {
+                D3D11_SHADER_INPUT_BIND_DESC desc {};
+                std::ignore = reflector->GetResourceBindingDesc(i, &desc);
+                reflection.boundResources.push_back(
+                  {desc.Name, CAST<u32>(desc.Type), desc.BindPoint, desc.BindCount});
+            }
+            ReflectParameters(reflector.Get(), shaderDesc.InputParameters, true, reflection.inputs);
+            ReflectParameters(reflector.Get(),
+                              shaderDesc.OutputParameters,
+                              false,
+                              reflection.outputs);
+            return reflection;
+        }
+    }  // namespace
+
+    void DxShader::LoadFromFile(const wstr& filename,
+                                const str& entryPoint,
+                                const vector<ShaderDefine>& defines) {
+        InitializeFromFile(filename, entryPoint, GetTarget(), defines);
+        CreateShaderObject();
+    }
+
+    void DxShader::LoadFromBytecode(const void* bytecode, size_t sizeInBytes) {
+        InitializeFromBytecode(bytecode, sizeInBytes);
+        CreateShaderObject();
+    }
+
+    void DxShader::LoadFromCompiled(const CompiledShader& compiled) {
+        InitializeFromCompiled(compiled);
+        CreateShaderObject();
+    }
+
+    CompiledShader DxShader::Compile(const ShaderSource& source) {
+        vector<D3D_SHADER_MACRO> macros;
+        for (const auto& define : source.defines) {
+            macros.push_back({define.name.c_str(), define.value.c_str()});
+        }
+        macros.push_back({None, None});
+
+        ComPtr<ID3DBlob> shaderBlob;
         ComPtr<ID3DBlob> errorBlob;
-        HRESULT hr = D3DCompileFromFile(filename.c_str(),
-                                        None,
-                                        D3D_COMPILE_STANDARD_FILE_INCLUDE,
-                                        entryPoint.c_str(),
-                                        target.c_str(),
-                                        D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION,
-                                        0,
-                                        &_shaderBlob,
-                                        &errorBlob);
+        const wstr filename = std::filesystem::path(source.path.Str()).wstring();
+        const HRESULT hr    = D3DCompileFromFile(filename.c_str(),
+                                                 macros.data(),
+                                                 D3D_COMPILE_STANDARD_FILE_INCLUDE,
+                                                 source.entryPoint.c_str(),
+                                                 source.target.c_str(),
+                                                 source.flags,
+                                                 0,
+                                                 &shaderBlob,
+                                                 &errorBlob);
         if (FAILED(hr)) {
             str errorMessage = "Failed to compile shader: ";
             if (errorBlob) errorMessage += CAST<cstr>(errorBlob->GetBufferPointer());
             Panic(errorMessage.c_str());
         }
-        hr = D3DReflect(_shaderBlob->GetBufferPointer(),
-                        _shaderBlob->GetBufferSize(),
-                        IID_ID3D11ShaderReflection,
-                        &_reflection);
-        if (FAILED(hr)) { Panic("Failed to retrieve shader reflection"); }
+
+        CompiledShader compiled;
+        const auto* bytecode = CAST<const u8*>(shaderBlob->GetBufferPointer());
+        compiled.bytecode.assign(bytecode, bytecode + shaderBlob->GetBufferSize());
+        compiled.reflection = Reflect(bytecode, shaderBlob->GetBufferSize());
+        return compiled;
+    }
+
+    void DxShader::InitializeFromFile(const wstr& filename,
+                                      const str& entryPoint,
+                                      const str& target,
+                                      const vector<ShaderDefine>& defines) {
+        const ShaderSource source {Filesystem::Path(std::filesystem::path(filename).string()),
+                                   entryPoint,
+                                   target,
+                                   defines,
+                                   kCompileFlags};
+        ShaderCache* cache = _device.GetShaderCache();
+        InitializeFromCompiled(cache ? cache->Load(source, Compile) : Compile(source));
+    }
+
+    void DxShader::InitializeFromBytecode(const void* bytecode, size_t sizeInBytes) {
+        if (FAILED(D3DCreateBlob(sizeInBytes, &_shaderBlob))) {
+            Panic("Failed to allocate shader blob");
+        }
+        memcpy(_shaderBlob->GetBufferPointer(), bytecode, sizeInBytes);
+        _reflection = Reflect(bytecode, sizeInBytes);
+    }
+
+    void DxShader::InitializeFromCompiled(const CompiledShader& compiled) {
+        if (FAILED(D3DCreateBlob(compiled.bytecode.size(), &_shaderBlob))) {
+            Panic("Failed to allocate shader blob");
+        }
+        memcpy(_shaderBlob->GetBufferPointer(), compiled.bytecode.data(), compiled.bytecode.size());
+        _reflection = compiled.reflection;
+    }
+
+    void DxVertexShader::Bind(DxCommandContext& context) const {
+        context.GetStateCache().SetVertexShader(CAST<ID3D11VertexShader*>(_shader.Get()));
+    }
+
+    void DxVertexShader::CreateShaderObject() {
+        ComPtr<ID3D11VertexShader> shader;
+        const HRESULT hr = _device.GetDevice()->CreateVertexShader(
+          _shaderBlob->GetBufferPointer(), _shaderBlob->GetBufferSize(), None, &shader);
+        if (FAILED(hr)) { Panic("Failed to create vertex shader"); }
+        _shader = shader;
+    }
+
+    void DxPixelShader::Bind(DxCommandContext& context) const {
+        context.GetStateCache().SetPixelShader(CAST<ID3D11PixelShader*>(_shader.Get()));
+    }
+
+    void DxPixelShader::CreateShaderObject() {
+        ComPtr<ID3D11PixelShader> shader;
+        const HRESULT hr = _device.GetDevice()->CreatePixelShader(
+          _shaderBlob->GetBufferPointer(), _shaderBlob->GetBufferSize(), None, &shader);
+        if (FAILED(hr)) { Panic("Failed to create pixel shader"); }
+        _shader = shader;
+    }
+
+    void DxComputeShader::Bind(DxCommandContext& context) const {
+        context.GetStateCache().SetComputeShader(CAST<ID3D11ComputeShader*>(_shader.Get()));
     }
 
-    D3D11_SHADER_DESC DxShader::GetShaderDesc() const {
-        D3D11_SHADER_DESC desc {};
-        std::ignore = _reflection->GetDesc(&desc);
-        return desc;
+    void DxComputeShader::CreateShaderObject() {
+        ComPtr<ID3D11ComputeShader> shader;
+        const HRESULT hr = _device.GetDevice()->CreateComputeShader(
+          _shaderBlob->GetBufferPointer(), _shaderBlob->GetBufferSize(), None, &shader);
+        if (FAILED(hr)) { Panic("Failed to create compute shader"); }
+        _shader = shader;
     }
 }  // namespace x::dx
\ No newline at end of file
@@ -5,6 +5,8 @@
 #pragma once
 
 #include "Types.hpp"
+#include "GraphicsDevice.hpp"
+#include "ShaderCache.hpp"
 #include "DxGraphicsDevice.hpp"
 #include <d3d11.h>
 #include <d3dcompiler.h>
@@ -13,29 +15,91 @@
 namespace x::dx {
     using Microsoft::WRL::ComPtr;
 
-    class DxShader {
+    class DxShader : public GraphicsShader {
     protected:
         DxGraphicsDevice& _device;
         ComPtr<ID3DBlob> _shaderBlob;
-        ComPtr<ID3D11ShaderReflection> _reflection;
+        ShaderReflection _reflection;
         ComPtr<ID3D11DeviceChild> _shader;
 
     public:
         explicit DxShader(DxGraphicsDevice& device) : _device(device) {}
-        virtual ~DxShader() = default;
+        ~DxShader() override = default;
+
+        // Goes through the device's ShaderCache when one is set.
+        void LoadFromFile(const wstr& filename,
+                          const str& entryPoint               = "main",
+                          const vector<ShaderDefine>& defines = {});
+        void LoadFromBytecode(const void* bytecode, size_t sizeInBytes);
+        // For results streamed in from a ShaderBuildService.
+        void LoadFromCompiled(const CompiledShader& compiled);
+
+        virtual void Bind(DxCommandContext& context) const = 0;
+
+        const ShaderReflection& GetReflection() const {
+            return _reflection;
+        }
+
+        // Compiles with D3DCompileFromFile and extracts reflection. Panics on errors.
+        static CompiledShader Compile(const ShaderSource& source);
 
     protected:
-        void InitializeFromFile(const wstr& filename, const str& entryPoint, const str& target);
-        D3D11_SHADER_DESC GetShaderDesc() const;
+        void InitializeFromFile(const wstr& filename,
+                                const str& entryPoint,
+                                const str& target,
+                                const vector<ShaderDefine>& defines);
+        void InitializeFromBytecode(const void* bytecode, size_t sizeInBytes);
+        void InitializeFromCompiled(const CompiledShader& compiled);
+
+        virtual cstr GetTarget() const    = 0;
+        virtual void CreateShaderObject() = 0;
     };
 
-    class DxVertexShader : public DxShader {
+    class DxVertexShader final : public DxShader {
     public:
         explicit DxVertexShader(DxGraphicsDevice& device) : DxShader(device) {}
-        void LoadFromFile(const wstr& filename, const str& entryPoint = "main");
+
+        ShaderStages GetStage() const override {
+            return ShaderStages::Vertex;
+        }
+        void Bind(DxCommandContext& context) const override;
+
+    protected:
+        cstr GetTarget() const override {
+            return "vs_5_0";
+        }
+        void CreateShaderObject() override;
+    };
+
+    class DxPixelShader final : public DxShader {
+    public:
+        explicit DxPixelShader(DxGraphicsDevice& device) : DxShader(device) {}
+
+        ShaderStages GetStage() const override {
+            return ShaderStages::Pixel;
+        }
+        void Bind(DxCommandContext& context) const override;
+
+    protected:
+        cstr GetTarget() const override {
+            return "ps_5_0";
+        }
+        void CreateShaderObject() override;
     };
 
-    class DxPixelShader : public DxShader {};
+    class DxComputeShader final : public DxShader {
+    public:
+        explicit DxComputeShader(DxGraphicsDevice& device) : DxShader(device) {}
+
+        ShaderStages GetStage() const override {
+            return ShaderStages::Compute;
+        }
+        void Bind(DxCommandContext& context) const override;
 
-    class DxComputeShader : public DxShader {};
+    protected:
+        cstr GetTarget() const override {
+            return "cs_5_0";
+        }
+        void CreateShaderObject() override;
+    };
 }  // namespace x::dx
@@ -0,0 +1,213 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "DxStateCache.hpp"
+#include "Panic.inl"
+
+namespace x::dx {
+    namespace {
+        constexpr ShaderStages kStages[] = {
+          ShaderStages::Vertex,
+          ShaderStages::Pixel,
+          ShaderStages::Compute,
+        };
+    }
+
+    DxStateCache::DxStateCache(ID3D11DeviceContext* context) : _context(context) {}
+
+    void DxStateCache::SetVertexBuffer(u32 slot, ID3D11Buffer* buffer, u32 stride, u32 offset) {
+        if (slot >= kVertexBufferSlots) { Panic("Vertex buffer slot %u is out of range.", slot); }
+        ++_frameStats.requested;
+        auto& pending = _pendingVertexBuffers;
+        if (pending.buffers[slot] == buffer && pending.strides[slot] == stride &&
+            pending.offsets[slot] == offset) {
+            ++_frameStats.elided;
+            return;
+        }
+        pending.buffers[slot] = buffer;
+        pending.strides[slot] = stride;
+        pending.offsets[slot] = offset;
+        _vertexBufferRange.Add(slot);
+    }
+
+    void DxStateCache::SetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, u32 offset) {
+        ++_frameStats.requested;
+        if (_indexBuffer == buffer && _indexFormat == format && _indexOffset == offset) {
+            ++_frameStats.elided;
+            return;
+        }
+        _indexBuffer = buffer;
+        _indexFormat = format;
+        _indexOffset = offset;
+        _context->IASetIndexBuffer(buffer, format, offset);
+        ++_frameStats.issued;
+    }
+
+    void DxStateCache::SetConstantBuffer(ShaderStages stages, u32 slot, ID3D11Buffer* buffer) {
+        if (slot >= kConstantBufferSlots) {
+            Panic("Constant buffer slot %u is out of range.", slot);
+        }
+        for (u32 stage = 0; stage < kStageCount; ++stage) {
+            if (!HasStage(stages, kStages[stage])) continue;
+            ++_frameStats.requested;
+            if (_pendingConstantBuffers[stage][slot] == buffer) {
+                ++_frameStats.elided;
+                continue;
+            }
+            _pendingConstantBuffers[stage][slot] = buffer;
+            _constantBufferRanges[stage].Add(slot);
+        }
+    }
+
+    void DxStateCache::SetInputLayout(ID3D11InputLayout* layout) {
+        ++_frameStats.requested;
+        if (_inputLayout == layout) {
+            ++_frameStats.elided;
+            return;
+        }
+        _inputLayout = layout;
+        _context->IASetInputLayout(layout);
+        ++_frameStats.issued;
+    }
+
+    void DxStateCache::SetVertexShader(ID3D11VertexShader* shader) {
+        ++_frameStats.requested;
+        if (_vertexShader == shader) {
+            ++_frameStats.elided;
+            return;
+        }
+        _vertexShader = shader;
+        _context->VSSetShader(shader, None, 0);
+        ++_frameStats.issued;
+    }
+
+    void DxStateCache::SetPixelShader(ID3D11PixelShader* shader) {
+        ++_frameStats.requested;
+        if (_pixelShader == shader) {
+            ++_frameStats.elided;
+            return;
+        }
+        _pixelShader = shader;
+        _context->PSSetShader(shader, None, 0);
+        ++_frameStats.issued;
+    }
+
+    void DxStateCache::SetComputeShader(ID3D11ComputeShader* shader) {
+        ++_frameStats.requested;
+        if (_computeShader == shader) {
+            ++_frameStats.elided;
+            return;
+        }
+        _computeShader = shader;
+        _context->CSSetShader(shader, None, 0);
+        ++_frameStats.issued;
+    }
+
+    void DxStateCache::Flush() {
+        FlushVertexBuffers();
+        for (u32 stage = 0; stage < kStageCount; ++stage) {
+            FlushConstantBuffers(stage);
+        }
+    }
+
+    void DxStateCache::Reset() {
+        _pendingVertexBuffers = {};
+        _boundVertexBuffers   = {};
+        _vertexBufferRange.Clear();
+        for (u32 stage = 0; stage < kStageCount; ++stage) {
+            _pendingConstantBuffers[stage].fill(None);
+            _boundConstantBuffers[stage].fill(None);
+            _constantBufferRanges[stage].Clear();
+        }
+        _indexBuffer   = None;
+        _indexFormat   = DXGI_FORMAT_UNKNOWN;
+        _indexOffset   = 0;
+        _inputLayout   = None;
+        _vertexShader  = None;
+        _pixelShader   = None;
+        _computeShader = None;
+    }
+
+    void DxStateCache::BeginFrame() {
+        _lastFrameStats = _frameStats;
+        _frameStats     = {};
+    }
+
+    void DxStateCache::FlushVertexBuffers() {
+        if (_vertexBufferRange.IsEmpty()) return;
+
+        auto& pending = _pendingVertexBuffers;
+        auto& bound   = _boundVertexBuffers;
+
+        // Slots may have been set and then set back, so shrink the range to what differs
+        u32 first = _vertexBufferRange.first;
+        u32 last  = _vertexBufferRange.last;
+        _vertexBufferRange.Clear();
+        const auto differs = [&](u32 slot) {
+            return pending.buffers[slot] != bound.buffers[slot] ||
+                   pending.strides[slot] != bound.strides[slot] ||
+                   pending.offsets[slot] != bound.offsets[slot];
+        };
+        while (first <= last && !differs(first)) {
+            ++first;
+        }
+        while (last > first && !differs(last)) {
+            --last;
+        }
+        if (first > last) return;
+
+        const u32 count = last - first + 1;
+        _context->IASetVertexBuffers(first,
+                                     count,
+                                     &pending.buffers[first],
+                                     &pending.strides[first],
+                                     &pending.offsets[first]);
+        ++_frameStats.issued;
+
+        for (u32 slot = first; slot <= last; ++slot) {
+            bound.buffers[slot] = pending.buffers[slot];
+            bound.strides[slot] = pending.strides[slot];
+            bound.offsets[slot] = pending.offsets[slot];
+        }
+    }
+
+    void DxStateCache::FlushConstantBuffers(u32 stage) {
+        auto& range = _constantBufferRanges[stage];
+        if (range.IsEmpty()) return;
+
+        auto& pending = _pendingConstantBuffers[stage];
+        auto& bound   = _boundConstantBuffers[stage];
+
+        u32 first = range.first;
+        u32 last  = range.last;
+        range.Clear();
+        while (first <= last && pending[first] == bound[first]) {
+            ++first;
+        }
+        while (last > first && pending[last] == bound[last]) {
+            --last;
+        }
+        if (first > last) return;
+
+        const u32 count = last - first + 1;
+        switch (kStages[stage]) {
+            case ShaderStages::Vertex:
+                _context->VSSetConstantBuffers(first, count, &pending[first]);
+                break;
+            case ShaderStages::Pixel:
+                _context->PSSetConstantBuffers(first, count, &pending[first]);
+                break;
+            case ShaderStages::Compute:
+                _context->CSSetConstantBuffers(first, count, &pending[first]);
+                break;
+            default:
+                return;
+        }
+        ++_frameStats.issued;
+
+        for (u32 slot = first; slot <= last; ++slot) {
+            bound[slot] = pending[slot];
+        }
+    }
+}  // namespace x::dx
@@ -0,0 +1,111 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "DxBuffer.hpp"
+#include <d3d11.h>
+
+namespace x::dx {
+    // Shadows the pipeline bindings of a device context to filter out redundant state changes.
+    // Vertex and constant buffer binds are deferred until Flush() (called before every draw)
+    // so that adjacent slots set individually go to the driver as a single ranged call.
+    class DxStateCache {
+    public:
+        struct Stats {
+            u32 requested = 0;  // Bind calls made against the cache
+            u32 issued    = 0;  // Calls that reached the device context
+            u32 elided    = 0;  // Requests dropped because the state was already bound
+        };
+
+        explicit DxStateCache(ID3D11DeviceContext* context);
+
+        DxStateCache(const DxStateCache&)            = delete;
+        DxStateCache& operator=(const DxStateCache&) = delete;
+
+        void SetVertexBuffer(u32 slot, ID3D11Buffer* buffer, u32 stride, u32 offset);
+        void SetIndexBuffer(ID3D11Buffer* buffer, DXGI_FORMAT format, u32 offset);
+        void SetConstantBuffer(ShaderStages stages, u32 slot, ID3D11Buffer* buffer);
+
+        void SetInputLayout(ID3D11InputLayout* layout);
+        void SetVertexShader(ID3D11VertexShader* shader);
+        void SetPixelShader(ID3D11PixelShader* shader);
+        void SetComputeShader(ID3D11ComputeShader* shader);
+
+        // Submits pending vertex/constant buffer ranges to the context.
+        void Flush();
+
+        // Forgets all bindings, mirroring ID3D11DeviceContext::ClearState.
+        void Reset();
+
+        // Rolls the per-frame counters.
+        void BeginFrame();
+
+        const Stats& GetFrameStats() const {
+            return _frameStats;
+        }
+
+        const Stats& GetLastFrameStats() const {
+            return _lastFrameStats;
+        }
+
+    private:
+        static constexpr u32 kStageCount        = 3;
+        static constexpr u32 kVertexBufferSlots = D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT;
+        static constexpr u32 kConstantBufferSlots =
+          D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT;
+
+        struct DirtyRange {
+            u32 first = ~0u;
+            u32 last  = 0;
+
+            void Add(u32 slot) {
+                first = first < slot ? first : slot;
+                last  = last > slot ? last : slot;
+            }
+
+            bool IsEmpty() const {
+                return first > last;
+            }
+
+            void Clear() {
+                first = ~0u;
+                last  = 0;
+            }
+        };
+
+        struct VertexBufferState {
+            array<ID3D11Buffer*, kVertexBufferSlots> buffers {};
+            array<u32, kVertexBufferSlots> strides {};
+            array<u32, kVertexBufferSlots> offsets {};
+        };
+
+        using ConstantBufferState = array<ID3D11Buffer*, kConstantBufferSlots>;
+
+        ID3D11DeviceContext* _context;
+
+        VertexBufferState _pendingVertexBuffers;
+        VertexBufferState _boundVertexBuffers;
+        DirtyRange _vertexBufferRange;
+
+        array<ConstantBufferState, kStageCount> _pendingConstantBuffers {};
+        array<ConstantBufferState, kStageCount> _boundConstantBuffers {};
+        array<DirtyRange, kStageCount> _constantBufferRanges;
+
+        ID3D11Buffer* _indexBuffer          = None;
+        DXGI_FORMAT _indexFormat            = DXGI_FORMAT_UNKNOWN;
+        u32 _indexOffset                    = 0;
+        ID3D11InputLayout* _inputLayout     = None;
+        ID3D11VertexShader* _vertexShader   = None;
+        ID3D11PixelShader* _pixelShader     = None;
+        ID3D11ComputeShader* _computeShader = None;
+
+        Stats _frameStats;
+        Stats _lastFrameStats;
+
+        void FlushVertexBuffers();
+        void FlushConstantBuffers(u32 stage);
+    };
+}  // namespace x::dx
@@ -0,0 +1,85 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "DxUploadRing.hpp"
+#include "Panic.inl"
+
+namespace x::dx {
+    DxUploadRing::DxUploadRing(DxGraphicsDevice& device,
+                               u32 capacity,
+                               u32 bindFlags,
+                               u32 framesInFlight)
+        : _device(device), _allocator(capacity),
+          _framesInFlight(framesInFlight > 0 ? framesInFlight : 1) {
+        BufferDescription desc;
+        desc.sizeInBytes    = capacity;
+        desc.usage          = D3D11_USAGE_DYNAMIC;
+        desc.bindFlags      = bindFlags;
+        desc.cpuAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        _buffer             = _device.CreateBuffer(desc);
+    }
+
+    void DxUploadRing::BeginFrame() {
+        RetireCompletedFrames(false);
+        while (_pendingFrames.size() >= _framesInFlight) {
+            RetireCompletedFrames(true);
+        }
+    }
+
+    void DxUploadRing::EndFrame() {
+        const auto fence = AcquireFence();
+        _device.GetImmediateContext().GetContext()->End(fence.Get());
+        _allocator.EndFrame(_frameId);
+        _pendingFrames.push_back({_frameId, fence});
+        ++_frameId;
+    }
+
+    std::optional<DxUploadRing::Suballocation>
+    DxUploadRing::Upload(const void* data, u32 sizeInBytes, u32 alignment) {
+        const auto allocation = _allocator.Allocate(sizeInBytes, alignment);
+        if (!allocation.has_value()) return Empty;
+
+        const auto offset = CAST<u32>(allocation->offset);
+        _buffer->UpdateRange(_device.GetImmediateContext(),
+                             data,
+                             sizeInBytes,
+                             offset,
+                             allocation->wrapped);
+        return Suballocation {_buffer.get(), offset, sizeInBytes};
+    }
+
+    void DxUploadRing::RetireCompletedFrames(bool wait) {
+        auto* context   = _device.GetImmediateContext().GetContext();
+        const u32 flags = wait ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH;
+        while (!_pendingFrames.empty()) {
+            auto& frame      = _pendingFrames.front();
+            BOOL done        = FALSE;
+            const HRESULT hr = context->GetData(frame.fence.Get(), &done, sizeof(done), flags);
+            if (hr != S_OK || !done) {
+                if (!wait) return;
+                continue;
+            }
+
+            _allocator.Retire(frame.frameId);
+            _freeFences.push_back(frame.fence);
+            _pendingFrames.pop_front();
+            if (wait) return;
+        }
+    }
+
+    ComPtr<ID3D11Query> DxUploadRing::AcquireFence() {
+        if (!_freeFences.empty()) {
+            auto fence = _freeFences.back();
+            _freeFences.pop_back();
+            return fence;
+        }
+
+        D3D11_QUERY_DESC desc = {D3D11_QUERY_EVENT, 0};
+        ComPtr<ID3D11Query> fence;
+        if (FAILED(_device.GetDevice()->CreateQuery(&desc, &fence))) {
+            Panic("Failed to create frame fence query");
+        }
+        return fence;
+    }
+}  // namespace x::dx
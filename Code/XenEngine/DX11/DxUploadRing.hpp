@@ -0,0 +1,69 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "RingAllocator.hpp"
+#include "DxGraphicsDevice.hpp"
+#include <deque>
+
+namespace x::dx {
+    // Transient per-frame upload heap. Small per-draw vertex/index updates are suballocated
+    // from one large dynamic buffer and written with MAP_NO_OVERWRITE; the buffer is only
+    // discarded when the ring wraps. Each frame is fenced with an event query and its space
+    // is reclaimed once the GPU has consumed it. Uploads always go through the immediate
+    // context, since deferred contexts can't map with NO_OVERWRITE.
+    class DxUploadRing {
+    public:
+        struct Suballocation {
+            DxBuffer* buffer;
+            u32 offset;
+            u32 size;
+        };
+
+        static constexpr u32 kDefaultFramesInFlight = 3;
+
+        DxUploadRing(DxGraphicsDevice& device,
+                     u32 capacity,
+                     u32 bindFlags      = D3D11_BIND_VERTEX_BUFFER | D3D11_BIND_INDEX_BUFFER,
+                     u32 framesInFlight = kDefaultFramesInFlight);
+
+        DxUploadRing(const DxUploadRing&)            = delete;
+        DxUploadRing& operator=(const DxUploadRing&) = delete;
+
+        // Retires completed frames. Blocks while `framesInFlight` frames are still pending.
+        void BeginFrame();
+        // Fences everything uploaded since BeginFrame.
+        void EndFrame();
+
+        // Copies `data` into the ring. Returns Empty when the ring is exhausted for this frame.
+        std::optional<Suballocation> Upload(const void* data, u32 sizeInBytes, u32 alignment = 16);
+
+        DxBuffer& GetBuffer() const {
+            return *_buffer;
+        }
+
+        const RingAllocator& GetAllocator() const {
+            return _allocator;
+        }
+
+    private:
+        struct PendingFrame {
+            u64 frameId;
+            ComPtr<ID3D11Query> fence;
+        };
+
+        DxGraphicsDevice& _device;
+        shared_ptr<DxBuffer> _buffer;
+        RingAllocator _allocator;
+        u32 _framesInFlight;
+        u64 _frameId = 0;
+        std::deque<PendingFrame> _pendingFrames;
+        vector<ComPtr<ID3D11Query>> _freeFences;
+
+        void RetireCompletedFrames(bool wait);
+        ComPtr<ID3D11Query> AcquireFence();
+    };
+}  // namespace x::dx
@@ -0,0 +1,134 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "DeferredReleaseQueue.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+
+namespace x {
+    DeferredReleaseQueue::DeferredReleaseQueue(const DeferredReleaseOptions& options)
+        : _options(options),
+          _thread(options.backgroundRelease ? std::thread([this]() { ReleaseLoop(); })
+                                            : std::thread()) {}
+
+    DeferredReleaseQueue::~DeferredReleaseQueue() {
+        Flush();
+        if (_thread.joinable()) {
+            {
+                std::lock_guard lock(_mutex);
+                _stopping = true;
+            }
+            _wake.notify_one();
+            _thread.join();
+        }
+    }
+
+    void DeferredReleaseQueue::Release(unique_ptr<Resource> resource, size_t bytes) {
+        if (!resource) { return; }
+        Park({std::move(resource), None, bytes});
+    }
+
+    void DeferredReleaseQueue::BeginFrame() {
+        vector<Entry> freed;
+        {
+            std::lock_guard lock(_mutex);
+            ++_frame;
+
+            DeferredReleaseStats stats;
+            stats.queued      = _queued;
+            stats.queuedBytes = _queuedBytes;
+            _queued           = 0;
+            _queuedBytes      = 0;
+
+            size_t budget = _options.maxReleasesPerFrame > 0 ? _options.maxReleasesPerFrame
+                                                             : ~size_t(0);
+            while (!_batches.empty() && budget > 0) {
+                Batch& batch = _batches.front();
+                if (_frame - batch.frame < _options.frameLatency) { break; }
+
+                const size_t count = std::min(budget, batch.entries.size() - batch.next);
+                for (size_t i = batch.next; i < batch.next + count; ++i) {
+                    stats.releasedBytes += batch.entries[i].bytes;
+                    freed.push_back(std::move(batch.entries[i]));
+                }
+                batch.next += count;
+                budget -= count;
+                if (batch.next == batch.entries.size()) { _batches.pop_front(); }
+            }
+
+            stats.released = CAST<u32>(freed.size());
+            _pending -= stats.released;
+            _pendingBytes -= stats.releasedBytes;
+            stats.pending      = _pending;
+            stats.pendingBytes = _pendingBytes;
+            _lastFrameStats    = stats;
+
+            if (_thread.joinable()) {
+                if (!freed.empty()) {
+                    std::move(freed.begin(), freed.end(), std::back_inserter(_retired));
+                    _wake.notify_one();
+                }
+                return;
+            }
+        }
+        Free(freed);
+    }
+
+    void DeferredReleaseQueue::Flush() {
+        vector<Entry> freed;
+        {
+            std::unique_lock lock(_mutex);
+            for (Batch& batch : _batches) {
+                std::move(batch.entries.begin() + CAST<ptrdiff_t>(batch.next),
+                          batch.entries.end(),
+                          std::back_inserter(freed));
+            }
+            _batches.clear();
+            _pending      = 0;
+            _pendingBytes = 0;
+            // Whatever the release thread holds is older than what was still parked
+            _drained.wait(lock, [this]() { return _retired.empty() && !_releasing; });
+        }
+        Free(freed);
+    }
+
+    void DeferredReleaseQueue::Park(Entry&& entry) {
+        std::lock_guard lock(_mutex);
+        if (_batches.empty() || _batches.back().frame != _frame) {
+            _batches.push_back({_frame, {}, 0});
+        }
+        ++_queued;
+        _queuedBytes += entry.bytes;
+        ++_pending;
+        _pendingBytes += entry.bytes;
+        _batches.back().entries.push_back(std::move(entry));
+    }
+
+    void DeferredReleaseQueue::Free(vector<Entry>& entries) {
+        X_PROFILE_FUNCTION();
+        for (Entry& entry : entries) {
+            if (entry.resource) { entry.resource->Release(); }
+        }
+        entries.clear();
+    }
+
+    void DeferredReleaseQueue::ReleaseLoop() {
+        X_PROFILE_THREAD("DeferredRelease");
+        std::unique_lock lock(_mutex);
+        while (true) {
+            _wake.wait(lock, [this]() { return _stopping || !_retired.empty(); });
+            if (_retired.empty()) { return; }
+
+            vector<Entry> batch = std::move(_retired);
+            _retired.clear();
+            _releasing = true;
+            lock.unlock();
+            Free(batch);
+            lock.lock();
+            _releasing = false;
+            _drained.notify_all();
+        }
+    }
+}  // namespace x
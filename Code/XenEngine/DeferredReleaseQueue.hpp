@@ -0,0 +1,119 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "GraphicsDevice.hpp"
+#include "Resource.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace x {
+    struct DeferredReleaseOptions {
+        // Frames an object stays parked before it is freed. D3D11 lets the driver queue up to
+        // three frames by default, so anything the GPU could still be reading survives that.
+        u32 frameLatency = 3;
+        // Caps how many objects one BeginFrame frees; the rest carry over to the next frame.
+        // Zero frees everything that has retired.
+        u32 maxReleasesPerFrame = 0;
+        // Frees retired objects on a dedicated thread instead of inside BeginFrame.
+        bool backgroundRelease = false;
+    };
+
+    struct DeferredReleaseStats {
+        u32 queued        = 0;  // Parked since the previous BeginFrame
+        u64 queuedBytes   = 0;
+        u32 released      = 0;  // Freed (or handed to the release thread) by this BeginFrame
+        u64 releasedBytes = 0;
+        u32 pending       = 0;  // Still parked afterwards
+        u64 pendingBytes  = 0;
+    };
+
+    // Parks GPU-backed objects until the frames that may reference them have retired, then
+    // frees them in batches. Freeing a buffer mid-frame makes the driver synchronize; freeing
+    // it a few frames later, all at once, does not. Release() is thread-safe; BeginFrame() and
+    // Flush() belong to the render thread.
+    class DeferredReleaseQueue {
+    public:
+        explicit DeferredReleaseQueue(
+          const DeferredReleaseOptions& options = DeferredReleaseOptions());
+        // Frees everything still parked. The GPU must be idle.
+        ~DeferredReleaseQueue();
+
+        DeferredReleaseQueue(const DeferredReleaseQueue&)            = delete;
+        DeferredReleaseQueue& operator=(const DeferredReleaseQueue&) = delete;
+
+        // Calls resource->Release() and destroys it once it retires. Resources don't know their
+        // size, so `bytes` is only for the statistics.
+        void Release(unique_ptr<Resource> resource, size_t bytes = 0);
+
+        // Drops this reference once it retires. The object is only freed then if this was the
+        // last reference. Buffers report their own size.
+        template<typename T>
+        void Release(shared_ptr<T> object, size_t bytes = 0) {
+            if (!object) { return; }
+            if constexpr (std::is_base_of_v<GraphicsBuffer, T>) {
+                if (bytes == 0) { bytes = object->GetSize(); }
+            }
+            Park({None, std::move(object), bytes});
+        }
+
+        // Ends a frame: frees what was parked `frameLatency` frames ago and snapshots the
+        // statistics. Call once per frame, next to GraphicsDevice::BeginFrame().
+        void BeginFrame();
+
+        // Frees everything parked, regardless of latency, and waits for the release thread.
+        // Only safe once the GPU is idle, e.g. at shutdown or after a device flush.
+        void Flush();
+
+        u64 GetFrameIndex() const {
+            return _frame;
+        }
+
+        const DeferredReleaseStats& GetLastFrameStats() const {
+            return _lastFrameStats;
+        }
+
+    private:
+        struct Entry {
+            unique_ptr<Resource> resource;
+            shared_ptr<void> object;
+            size_t bytes;
+        };
+
+        struct Batch {
+            u64 frame;
+            vector<Entry> entries;
+            size_t next = 0;  // Entries before this were already released
+        };
+
+        DeferredReleaseOptions _options;
+        u64 _frame = 0;
+        DeferredReleaseStats _lastFrameStats;
+
+        std::mutex _mutex;
+        std::deque<Batch> _batches;  // Oldest first
+        u32 _queued       = 0;
+        u64 _queuedBytes  = 0;
+        u32 _pending      = 0;
+        u64 _pendingBytes = 0;
+
+        // Release thread state, guarded by `_mutex`
+        vector<Entry> _retired;
+        std::condition_variable _wake;
+        std::condition_variable _drained;
+        bool _releasing = false;
+        bool _stopping  = false;
+        // Last, so everything the release thread touches is initialized before it starts
+        std::thread _thread;
+
+        void Park(Entry&& entry);
+        static void Free(vector<Entry>& entries);
+        void ReleaseLoop();
+    };
+}  // namespace x
@@ -22,7 +22,13 @@ namespace x {
         }
 
         void DestroyEntity(EntityId entity) {
-            _transforms.RemoveComponent(entity);
+            ForEachComponentManager([entity](auto& manager) { manager.RemoveComponent(entity); });
+        }
+
+        // Mid-frame teardown: component resources are released once `queue` retires them.
+        void DestroyEntity(EntityId entity, DeferredReleaseQueue& queue) {
+            ForEachComponentManager(
+              [entity, &queue](auto& manager) { manager.RemoveComponent(entity, queue); });
         }
 
         GameState Clone() const {
@@ -32,8 +38,16 @@ namespace x {
             return newState;
         }
 
+        // Assets are owned through AssetHandles and go back to the AssetManager on their own;
+        // this covers components that hold resources directly. Managers of components without
+        // resources ignore it.
         void ReleaseAllResources() {
-            // TODO: Release component resources
+            ForEachComponentManager([](auto& manager) { manager.ReleaseResources(); });
+        }
+
+        // Hands every resource-owning component to `queue` and removes it from the state.
+        void ReleaseAllResources(DeferredReleaseQueue& queue) {
+            ForEachComponentManager([&queue](auto& manager) { manager.ReleaseResources(queue); });
         }
 
         template<typename T>
@@ -78,11 +92,11 @@ namespace x {
         u64 _nextId = 0;
         ComponentManager<TransformComponent> _transforms;
 
-        template<typename T>
-        void ReleaseComponentResources() {
-            if constexpr (detail::release_resources<T>::value) {
-                GetComponents<T>().ReleaseResources();
-            }
+        // Every component manager the state owns. A new component type is added here, and
+        // entity teardown and resource release pick it up.
+        template<typename Func>
+        void ForEachComponentManager(Func&& func) {
+            func(_transforms);
         }
     };
 }  // namespace x
@@ -0,0 +1,179 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+
+namespace x {
+    enum class ShaderStages : u32 {
+        None    = 0,
+        Vertex  = 1 << 0,
+        Pixel   = 1 << 1,
+        Compute = 1 << 2,
+    };
+
+    inline ShaderStages operator|(ShaderStages a, ShaderStages b) {
+        return CAST<ShaderStages>(CAST<u32>(a) | CAST<u32>(b));
+    }
+
+    inline ShaderStages operator&(ShaderStages a, ShaderStages b) {
+        return CAST<ShaderStages>(CAST<u32>(a) & CAST<u32>(b));
+    }
+
+    inline bool HasStage(ShaderStages stages, ShaderStages stage) {
+        return (CAST<u32>(stages) & CAST<u32>(stage)) != 0;
+    }
+
+    enum class BufferUsage : u32 {
+        Default,
+        Immutable,
+        Dynamic,
+    };
+
+    enum class BufferBindings : u32 {
+        None           = 0,
+        Vertex         = 1 << 0,
+        Index          = 1 << 1,
+        Constant       = 1 << 2,
+        ShaderResource = 1 << 3,
+    };
+
+    inline BufferBindings operator|(BufferBindings a, BufferBindings b) {
+        return CAST<BufferBindings>(CAST<u32>(a) | CAST<u32>(b));
+    }
+
+    inline bool HasBinding(BufferBindings bindings, BufferBindings binding) {
+        return (CAST<u32>(bindings) & CAST<u32>(binding)) != 0;
+    }
+
+    enum class IndexFormat : u32 {
+        U16,
+        U32,
+    };
+
+    struct GraphicsBufferDescription {
+        u32 sizeInBytes         = 0;
+        BufferUsage usage       = BufferUsage::Default;
+        BufferBindings bindings = BufferBindings::None;
+        u32 structureByteStride = 0;
+        const void* initialData = None;
+    };
+
+    // Backend-neutral rendering surface. DX11 is one implementation; the null backend
+    // records commands and counts traffic so CPU-side rendering code runs headlessly.
+
+    class GraphicsBuffer {
+    public:
+        virtual ~GraphicsBuffer() = default;
+
+        virtual u32 GetSize() const                                = 0;
+        virtual bool IsDynamic() const                             = 0;
+        virtual bool SupportsBinding(BufferBindings binding) const = 0;
+    };
+
+    class GraphicsShader {
+    public:
+        virtual ~GraphicsShader() = default;
+
+        virtual ShaderStages GetStage() const = 0;
+    };
+
+    // Opaque result of recording on a deferred command context.
+    class CommandList {
+    public:
+        virtual ~CommandList() = default;
+    };
+
+    class CommandContext {
+    public:
+        virtual ~CommandContext() = default;
+
+        virtual void UpdateBuffer(GraphicsBuffer& buffer, const void* data, size_t sizeInBytes) = 0;
+        virtual void UpdateBufferRange(GraphicsBuffer& buffer,
+                                       const void* data,
+                                       size_t sizeInBytes,
+                                       u32 offset,
+                                       bool discard)                                         = 0;
+
+        virtual void BindVertexBuffer(u32 slot, GraphicsBuffer& buffer, u32 stride, u32 offset) = 0;
+        virtual void BindIndexBuffer(GraphicsBuffer& buffer, IndexFormat format, u32 offset)   = 0;
+        virtual void BindConstantBuffer(u32 slot, ShaderStages stages, GraphicsBuffer& buffer) = 0;
+        virtual void BindShader(const GraphicsShader& shader)                                  = 0;
+
+        virtual void Draw(u32 vertexCount, u32 startVertex)                           = 0;
+        virtual void DrawIndexed(u32 indexCount, u32 startIndex, i32 baseVertex)      = 0;
+        virtual void DrawIndexedInstanced(u32 indexCountPerInstance,
+                                          u32 instanceCount,
+                                          u32 startIndex,
+                                          i32 baseVertex,
+                                          u32 startInstance)                          = 0;
+
+        // Deferred contexts only.
+        virtual unique_ptr<CommandList> Finish() = 0;
+        // Immediate context only.
+        virtual void Execute(CommandList& commandList) = 0;
+    };
+
+    class GraphicsDevice {
+    public:
+        virtual ~GraphicsDevice() = default;
+
+        virtual shared_ptr<GraphicsBuffer> CreateBuffer(const GraphicsBufferDescription& desc) = 0;
+        virtual shared_ptr<GraphicsShader>
+        CreateShader(ShaderStages stage, const void* bytecode, size_t sizeInBytes) = 0;
+
+        virtual CommandContext& GetImmediateContext()          = 0;
+        virtual unique_ptr<CommandContext> CreateCommandContext() = 0;
+
+        virtual void BeginFrame() = 0;
+
+        shared_ptr<GraphicsBuffer>
+        CreateVertexBuffer(const void* data, u32 sizeInBytes, bool dynamic = false) {
+            return CreateBuffer({sizeInBytes,
+                                 dynamic ? BufferUsage::Dynamic : BufferUsage::Default,
+                                 BufferBindings::Vertex,
+                                 0,
+                                 data});
+        }
+
+        shared_ptr<GraphicsBuffer>
+        CreateIndexBuffer(const void* data, u32 sizeInBytes, bool dynamic = false) {
+            return CreateBuffer({sizeInBytes,
+                                 dynamic ? BufferUsage::Dynamic : BufferUsage::Default,
+                                 BufferBindings::Index,
+                                 0,
+                                 data});
+        }
+
+        shared_ptr<GraphicsBuffer> CreateConstantBuffer(u32 sizeInBytes) {
+            return CreateBuffer(
+              {sizeInBytes, BufferUsage::Dynamic, BufferBindings::Constant, 0, None});
+        }
+    };
+
+    // ParallelRecorder backend over any GraphicsDevice.
+    class GraphicsRecordingBackend {
+    public:
+        using Context     = CommandContext;
+        using CommandList = unique_ptr<x::CommandList>;
+
+        explicit GraphicsRecordingBackend(GraphicsDevice& device) : _device(device) {}
+
+        unique_ptr<Context> CreateContext() {
+            return _device.CreateCommandContext();
+        }
+
+        CommandList Finish(Context& context) {
+            return context.Finish();
+        }
+
+        void Execute(CommandList& commandList) {
+            _device.GetImmediateContext().Execute(*commandList);
+        }
+
+    private:
+        GraphicsDevice& _device;
+    };
+}  // namespace x
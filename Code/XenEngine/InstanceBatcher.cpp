@@ -0,0 +1,63 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "InstanceBatcher.hpp"
+
+#include <algorithm>
+
+namespace x {
+    using namespace DirectX;
+
+    InstanceBatcher::InstanceBatcher(u32 maxBatchSize)
+        : _maxBatchSize(maxBatchSize > 0 ? maxBatchSize : 1) {}
+
+    void InstanceBatcher::Reset() {
+        _submissions.clear();
+        _instances.clear();
+        _batches.clear();
+    }
+
+    void InstanceBatcher::Add(EntityId entity, u64 mesh, u64 material) {
+        _submissions.push_back({mesh, material, entity});
+    }
+
+    void InstanceBatcher::Build(const Scene& scene) {
+        _instances.clear();
+        _batches.clear();
+        if (_submissions.empty()) return;
+
+        // Material changes are more expensive than mesh changes, so sort by material first
+        std::sort(_submissions.begin(),
+                  _submissions.end(),
+                  [](const Submission& a, const Submission& b) {
+                      if (a.material != b.material) return a.material < b.material;
+                      if (a.mesh != b.mesh) return a.mesh < b.mesh;
+                      return a.entity < b.entity;
+                  });
+
+        _instances.resize(_submissions.size());
+        for (size_t i = 0; i < _submissions.size(); ++i) {
+            XMStoreFloat4x4(&_instances[i].world,
+                            scene.GetWorldTransform(_submissions[i].entity));
+        }
+
+        size_t groupStart = 0;
+        while (groupStart < _submissions.size()) {
+            const auto& first = _submissions[groupStart];
+            size_t groupEnd   = groupStart + 1;
+            while (groupEnd < _submissions.size() && _submissions[groupEnd].mesh == first.mesh &&
+                   _submissions[groupEnd].material == first.material) {
+                ++groupEnd;
+            }
+
+            for (size_t offset = groupStart; offset < groupEnd; offset += _maxBatchSize) {
+                const auto count = std::min<size_t>(_maxBatchSize, groupEnd - offset);
+                _batches.push_back(
+                  {first.mesh, first.material, CAST<u32>(offset), CAST<u32>(count)});
+            }
+
+            groupStart = groupEnd;
+        }
+    }
+}  // namespace x
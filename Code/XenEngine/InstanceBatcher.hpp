@@ -0,0 +1,67 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "EntityId.hpp"
+#include "Scene.hpp"
+#include <DirectXMath.h>
+
+namespace x {
+    // Per-instance data streamed to the GPU alongside mesh vertices.
+    struct InstanceData {
+        DirectX::XMFLOAT4X4 world;
+    };
+
+    // A group of instances sharing the same mesh and material, drawn with a single
+    // instanced draw call. `firstInstance` indexes into the packed instance stream.
+    struct InstanceBatch {
+        u64 mesh;
+        u64 material;
+        u32 firstInstance;
+        u32 instanceCount;
+    };
+
+    class InstanceBatcher {
+    public:
+        static constexpr u32 kDefaultMaxBatchSize = 4096;
+
+        explicit InstanceBatcher(u32 maxBatchSize = kDefaultMaxBatchSize);
+
+        // Clears all submissions, batches and instance data. Capacity is retained.
+        void Reset();
+
+        // Submit a visible entity for drawing this frame.
+        void Add(EntityId entity, u64 mesh, u64 material);
+
+        // Groups submissions by material then mesh, packs their world transforms into
+        // the instance stream and emits one batch per group (split at the batch size cap).
+        void Build(const Scene& scene);
+
+        const vector<InstanceData>& GetInstances() const {
+            return _instances;
+        }
+
+        const vector<InstanceBatch>& GetBatches() const {
+            return _batches;
+        }
+
+        u32 GetMaxBatchSize() const {
+            return _maxBatchSize;
+        }
+
+    private:
+        struct Submission {
+            u64 mesh;
+            u64 material;
+            EntityId entity;
+        };
+
+        u32 _maxBatchSize;
+        vector<Submission> _submissions;
+        vector<InstanceData> _instances;
+        vector<InstanceBatch> _batches;
+    };
+}  // namespace x
@@ -0,0 +1,175 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "NullGraphicsDevice.hpp"
+#include "MemoryTracker.hpp"
+#include "Panic.inl"
+
+namespace x::null {
+    NullBuffer::NullBuffer(const GraphicsBufferDescription& desc)
+        : _data(desc.sizeInBytes), _usage(desc.usage), _bindings(desc.bindings) {
+        if (desc.initialData) { memcpy(_data.data(), desc.initialData, desc.sizeInBytes); }
+        MemoryTracker::Track(MemoryTag::Graphics, _data.size());
+    }
+
+    NullBuffer::~NullBuffer() {
+        MemoryTracker::Untrack(MemoryTag::Graphics, _data.size());
+    }
+
+    void NullBuffer::Write(const void* data, size_t sizeInBytes, u32 offset) {
+        if (_usage == BufferUsage::Immutable) { Panic("Cannot update an immutable buffer."); }
+        if (offset + sizeInBytes > _data.size()) { Panic("Update range exceeds buffer size."); }
+        memcpy(_data.data() + offset, data, sizeInBytes);
+    }
+
+    NullShader::NullShader(ShaderStages stage, const void* bytecode, size_t sizeInBytes)
+        : _stage(stage), _bytecode(CAST<const u8*>(bytecode),
+                                   CAST<const u8*>(bytecode) + sizeInBytes) {}
+
+    void NullCommandContext::UpdateBuffer(GraphicsBuffer& buffer,
+                                          const void* data,
+                                          size_t sizeInBytes) {
+        UpdateBufferRange(buffer, data, sizeInBytes, 0, true);
+    }
+
+    void NullCommandContext::UpdateBufferRange(GraphicsBuffer& buffer,
+                                               const void* data,
+                                               size_t sizeInBytes,
+                                               u32 offset,
+                                               bool discard) {
+        auto& nullBuffer = CAST<NullBuffer&>(buffer);
+        if (_deferred && nullBuffer.IsDynamic() && !discard) {
+            Panic("Deferred contexts only support discarding updates of dynamic buffers.");
+        }
+        nullBuffer.Write(data, sizeInBytes, offset);
+        Record(NullCommandType::UpdateBuffer,
+               &buffer,
+               {offset, CAST<u32>(sizeInBytes), discard ? 1u : 0u});
+        _stats.bytesUploaded += sizeInBytes;
+        _stats.uploads++;
+    }
+
+    void NullCommandContext::BindVertexBuffer(u32 slot,
+                                              GraphicsBuffer& buffer,
+                                              u32 stride,
+                                              u32 offset) {
+        if (!buffer.SupportsBinding(BufferBindings::Vertex)) {
+            Panic("Buffer description has incorrect bindings for vertex buffer.");
+        }
+        Record(NullCommandType::BindVertexBuffer, &buffer, {slot, stride, offset});
+        _stats.binds++;
+    }
+
+    void
+    NullCommandContext::BindIndexBuffer(GraphicsBuffer& buffer, IndexFormat format, u32 offset) {
+        if (!buffer.SupportsBinding(BufferBindings::Index)) {
+            Panic("Buffer description has incorrect bindings for index buffer.");
+        }
+        Record(NullCommandType::BindIndexBuffer, &buffer, {CAST<u32>(format), offset});
+        _stats.binds++;
+    }
+
+    void NullCommandContext::BindConstantBuffer(u32 slot,
+                                                ShaderStages stages,
+                                                GraphicsBuffer& buffer) {
+        if (!buffer.SupportsBinding(BufferBindings::Constant)) {
+            Panic("Buffer description has incorrect bindings for constant buffer.");
+        }
+        Record(NullCommandType::BindConstantBuffer, &buffer, {slot, CAST<u32>(stages)});
+        _stats.binds++;
+    }
+
+    void NullCommandContext::BindShader(const GraphicsShader& shader) {
+        Record(NullCommandType::BindShader, &shader, {CAST<u32>(shader.GetStage())});
+        _stats.binds++;
+    }
+
+    void NullCommandContext::Draw(u32 vertexCount, u32 startVertex) {
+        Record(NullCommandType::Draw, None, {vertexCount, startVertex});
+        _stats.draws++;
+        _stats.instances++;
+    }
+
+    void NullCommandContext::DrawIndexed(u32 indexCount, u32 startIndex, i32 baseVertex) {
+        Record(NullCommandType::DrawIndexed,
+               None,
+               {indexCount, startIndex, CAST<u32>(baseVertex)});
+        _stats.draws++;
+        _stats.instances++;
+    }
+
+    void NullCommandContext::DrawIndexedInstanced(u32 indexCountPerInstance,
+                                                  u32 instanceCount,
+                                                  u32 startIndex,
+                                                  i32 baseVertex,
+                                                  u32 startInstance) {
+        Record(NullCommandType::DrawIndexedInstanced,
+               None,
+               {indexCountPerInstance,
+                instanceCount,
+                startIndex,
+                CAST<u32>(baseVertex),
+                startInstance});
+        _stats.draws++;
+        _stats.instances += instanceCount;
+    }
+
+    unique_ptr<CommandList> NullCommandContext::Finish() {
+        if (!_deferred) { Panic("Finish called on the immediate context."); }
+        auto commandList      = make_unique<NullCommandList>();
+        commandList->commands = std::move(_commands);
+        commandList->stats    = _stats;
+        Clear();
+        return commandList;
+    }
+
+    void NullCommandContext::Execute(CommandList& commandList) {
+        if (_deferred) { Panic("Command lists must be executed on the immediate context."); }
+        const auto& nullList = CAST<const NullCommandList&>(commandList);
+        _commands.insert(_commands.end(), nullList.commands.begin(), nullList.commands.end());
+        _stats.Accumulate(nullList.stats);
+    }
+
+    void NullCommandContext::Clear() {
+        _commands.clear();
+        _stats = {};
+    }
+
+    void NullCommandContext::Record(NullCommandType type,
+                                    const void* resource,
+                                    array<u32, 5> args) {
+        _commands.push_back({type, resource, args});
+    }
+
+    NullGraphicsDevice::NullGraphicsDevice()
+        : _immediateContext(false), _bufferCount(0), _bufferBytes(0) {}
+
+    shared_ptr<GraphicsBuffer>
+    NullGraphicsDevice::CreateBuffer(const GraphicsBufferDescription& desc) {
+        if (desc.usage == BufferUsage::Immutable && !desc.initialData) {
+            Panic("Immutable buffers require initial data");
+        }
+        _bufferCount.fetch_add(1, std::memory_order_relaxed);
+        _bufferBytes.fetch_add(desc.sizeInBytes, std::memory_order_relaxed);
+        return make_shared<NullBuffer>(desc);
+    }
+
+    shared_ptr<GraphicsShader>
+    NullGraphicsDevice::CreateShader(ShaderStages stage, const void* bytecode, size_t sizeInBytes) {
+        if (stage != ShaderStages::Vertex && stage != ShaderStages::Pixel &&
+            stage != ShaderStages::Compute) {
+            Panic("CreateShader requires exactly one shader stage");
+        }
+        return make_shared<NullShader>(stage, bytecode, sizeInBytes);
+    }
+
+    unique_ptr<CommandContext> NullGraphicsDevice::CreateCommandContext() {
+        return make_unique<NullCommandContext>(true);
+    }
+
+    void NullGraphicsDevice::BeginFrame() {
+        _lastFrameStats = _immediateContext.GetStats();
+        _immediateContext.Clear();
+    }
+}  // namespace x::null
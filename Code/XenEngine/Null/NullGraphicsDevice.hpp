@@ -0,0 +1,194 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "GraphicsDevice.hpp"
+#include <atomic>
+
+namespace x::null {
+    // Headless backend. Nothing reaches a GPU: buffers keep a CPU copy of their contents and
+    // contexts record every command, so rendering code can run (and be checked) without a
+    // display or D3D runtime.
+
+    struct NullStats {
+        u64 bytesUploaded = 0;
+        u32 uploads       = 0;
+        u32 binds         = 0;
+        u32 draws         = 0;
+        u64 instances     = 0;
+
+        void Accumulate(const NullStats& other) {
+            bytesUploaded += other.bytesUploaded;
+            uploads += other.uploads;
+            binds += other.binds;
+            draws += other.draws;
+            instances += other.instances;
+        }
+    };
+
+    enum class NullCommandType : u8 {
+        UpdateBuffer,          // args: offset, size, discard
+        BindVertexBuffer,      // args: slot, stride, offset
+        BindIndexBuffer,       // args: format, offset
+        BindConstantBuffer,    // args: slot, stages
+        BindShader,            // args: stage
+        Draw,                  // args: vertexCount, startVertex
+        DrawIndexed,           // args: indexCount, startIndex, baseVertex
+        DrawIndexedInstanced,  // args: indexCount, instanceCount, startIndex, baseVertex,
+                               //       startInstance
+    };
+
+    struct NullCommand {
+        NullCommandType type;
+        const void* resource;  // Buffer or shader, None for draws
+        array<u32, 5> args;
+    };
+
+    class NullBuffer final : public GraphicsBuffer {
+    public:
+        explicit NullBuffer(const GraphicsBufferDescription& desc);
+        ~NullBuffer() override;
+
+        u32 GetSize() const override {
+            return CAST<u32>(_data.size());
+        }
+        bool IsDynamic() const override {
+            return _usage == BufferUsage::Dynamic;
+        }
+        bool SupportsBinding(BufferBindings binding) const override {
+            return (CAST<u32>(_bindings) & CAST<u32>(binding)) == CAST<u32>(binding);
+        }
+
+        void Write(const void* data, size_t sizeInBytes, u32 offset);
+
+        const vector<u8>& GetData() const {
+            return _data;
+        }
+
+    private:
+        vector<u8> _data;
+        BufferUsage _usage;
+        BufferBindings _bindings;
+    };
+
+    class NullShader final : public GraphicsShader {
+    public:
+        NullShader(ShaderStages stage, const void* bytecode, size_t sizeInBytes);
+
+        ShaderStages GetStage() const override {
+            return _stage;
+        }
+
+        const vector<u8>& GetBytecode() const {
+            return _bytecode;
+        }
+
+    private:
+        ShaderStages _stage;
+        vector<u8> _bytecode;
+    };
+
+    class NullCommandList final : public CommandList {
+    public:
+        vector<NullCommand> commands;
+        NullStats stats;
+    };
+
+    class NullCommandContext final : public CommandContext {
+    public:
+        explicit NullCommandContext(bool deferred) : _deferred(deferred) {}
+
+        NullCommandContext(const NullCommandContext&)            = delete;
+        NullCommandContext& operator=(const NullCommandContext&) = delete;
+
+        // Buffer contents are written when the update is recorded, not when the list executes.
+        void UpdateBuffer(GraphicsBuffer& buffer, const void* data, size_t sizeInBytes) override;
+        void UpdateBufferRange(GraphicsBuffer& buffer,
+                               const void* data,
+                               size_t sizeInBytes,
+                               u32 offset,
+                               bool discard) override;
+        void BindVertexBuffer(u32 slot, GraphicsBuffer& buffer, u32 stride, u32 offset) override;
+        void BindIndexBuffer(GraphicsBuffer& buffer, IndexFormat format, u32 offset) override;
+        void BindConstantBuffer(u32 slot, ShaderStages stages, GraphicsBuffer& buffer) override;
+        void BindShader(const GraphicsShader& shader) override;
+
+        void Draw(u32 vertexCount, u32 startVertex) override;
+        void DrawIndexed(u32 indexCount, u32 startIndex, i32 baseVertex) override;
+        void DrawIndexedInstanced(u32 indexCountPerInstance,
+                                  u32 instanceCount,
+                                  u32 startIndex,
+                                  i32 baseVertex,
+                                  u32 startInstance) override;
+
+        unique_ptr<CommandList> Finish() override;
+        void Execute(CommandList& commandList) override;
+
+        // Drops recorded commands and statistics.
+        void Clear();
+
+        bool IsDeferred() const {
+            return _deferred;
+        }
+
+        const vector<NullCommand>& GetCommands() const {
+            return _commands;
+        }
+
+        const NullStats& GetStats() const {
+            return _stats;
+        }
+
+    private:
+        vector<NullCommand> _commands;
+        NullStats _stats;
+        bool _deferred;
+
+        void Record(NullCommandType type, const void* resource, array<u32, 5> args = {});
+    };
+
+    class NullGraphicsDevice final : public GraphicsDevice {
+    public:
+        NullGraphicsDevice();
+
+        NullGraphicsDevice(const NullGraphicsDevice&)            = delete;
+        NullGraphicsDevice& operator=(const NullGraphicsDevice&) = delete;
+
+        shared_ptr<GraphicsBuffer> CreateBuffer(const GraphicsBufferDescription& desc) override;
+        shared_ptr<GraphicsShader>
+        CreateShader(ShaderStages stage, const void* bytecode, size_t sizeInBytes) override;
+
+        NullCommandContext& GetImmediateContext() override {
+            return _immediateContext;
+        }
+        unique_ptr<CommandContext> CreateCommandContext() override;
+
+        // Snapshots the immediate context's statistics and clears its recording.
+        void BeginFrame() override;
+
+        const NullStats& GetFrameStats() const {
+            return _immediateContext.GetStats();
+        }
+
+        const NullStats& GetLastFrameStats() const {
+            return _lastFrameStats;
+        }
+
+        u64 GetBufferCount() const {
+            return _bufferCount.load(std::memory_order_relaxed);
+        }
+
+        u64 GetBufferBytes() const {
+            return _bufferBytes.load(std::memory_order_relaxed);
+        }
+
+    private:
+        NullCommandContext _immediateContext;
+        NullStats _lastFrameStats;
+        std::atomic<u64> _bufferCount;
+        std::atomic<u64> _bufferBytes;
+    };
+}  // namespace x::null
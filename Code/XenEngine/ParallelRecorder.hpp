@@ -0,0 +1,71 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "ThreadPool.hpp"
+#include <functional>
+
+namespace x {
+    // Records command lists on worker threads and executes them in submission order on the
+    // calling thread. The graphics API is supplied by `Backend`, which must provide:
+    //
+    //   using Context     = ...;                  // A deferred/recording context
+    //   using CommandList = ...;                  // The result of finishing a context
+    //   unique_ptr<Context> CreateContext();
+    //   CommandList Finish(Context& context);     // Called on the recording worker
+    //   void Execute(CommandList& list);          // Called on the submitting thread
+    //
+    // Contexts are created lazily and reused across frames, one per job slot.
+    template<typename Backend>
+    class ParallelRecorder {
+    public:
+        using Context     = typename Backend::Context;
+        using CommandList = typename Backend::CommandList;
+        using RecordFunc  = std::function<void(Context&)>;
+
+        ParallelRecorder(Backend& backend, ThreadPool& pool) : _backend(backend), _pool(pool) {}
+
+        void Add(RecordFunc func) {
+            _jobs.push_back(std::move(func));
+        }
+
+        // Records every queued job concurrently, then executes the resulting lists in the order
+        // the jobs were added. Lists are executed as soon as all earlier ones have been, so
+        // submission overlaps with recording of later jobs.
+        void Execute() {
+            while (_contexts.size() < _jobs.size()) {
+                _contexts.push_back(_backend.CreateContext());
+            }
+
+            vector<std::future<CommandList>> pending;
+            pending.reserve(_jobs.size());
+            for (size_t i = 0; i < _jobs.size(); ++i) {
+                pending.push_back(_pool.Submit([this, i]() {
+                    auto& context = *_contexts[i];
+                    _jobs[i](context);
+                    return _backend.Finish(context);
+                }));
+            }
+
+            for (auto& future : pending) {
+                CommandList list = future.get();
+                _backend.Execute(list);
+            }
+
+            _jobs.clear();
+        }
+
+        size_t GetPendingJobCount() const {
+            return _jobs.size();
+        }
+
+    private:
+        Backend& _backend;
+        ThreadPool& _pool;
+        vector<RecordFunc> _jobs;
+        vector<unique_ptr<Context>> _contexts;
+    };
+}  // namespace x
@@ -3,15 +3,17 @@
 //
 
 #include "Scene.hpp"
+#include "FrameArena.hpp"
+#include "Profiler.hpp"
 
-#include <functional>
+#include <algorithm>
 
 namespace x {
     using namespace DirectX;
 
     EntityId Scene::CreateEntity(const std::optional<EntityId>& parent) {
         const EntityId entity = _state.CreateEntity();
-        const auto node       = make_shared<SceneNode>();
+        const auto node       = MakePooledShared<SceneNode, MemoryTag::Scene>();
         node->entity          = entity;
         node->localTransform  = XMMatrixIdentity();
         node->worldTransform  = XMMatrixIdentity();
@@ -37,18 +39,30 @@ namespace x {
         const auto it = _nodes.find(entity);
         if (it == _nodes.end()) return;
 
+        // Only the subtree's root leaves its parent; its descendants go down with it
         const auto node = it->second;
-        for (const auto& child : node->children) {
-            RemoveEntity(child->entity);
-        }
-
         if (const auto parent = node->parent.lock()) {
             auto& siblings = parent->children;
-            std::erase_if(siblings, [entity](const auto& n) { return n->entity == entity; });
+            siblings.erase(std::remove_if(siblings.begin(),
+                                          siblings.end(),
+                                          [entity](const auto& n) { return n->entity == entity; }),
+                           siblings.end());
         }
 
-        _nodes.erase(entity);
-        _state.DestroyEntity(entity);
+        // Every pending node is still held by _nodes until it is popped
+        ScratchScope scratch;
+        std::pmr::vector<const SceneNode*> pending({node.get()}, scratch.Resource());
+        while (!pending.empty()) {
+            const SceneNode* current = pending.back();
+            pending.pop_back();
+            for (const auto& child : current->children) {
+                pending.push_back(child.get());
+            }
+
+            const EntityId removed = current->entity;
+            DestroyEntity(removed);
+            _nodes.erase(removed);
+        }
         if (_root && _root->entity == entity) _root.reset();
     }
 
@@ -69,8 +83,11 @@ namespace x {
         // if child is already attached to a different parent, remove it from that parent first.
         if (const auto oldParent = childNode->parent.lock()) {
             auto& oldParentChildren = oldParent->children;
-            std::erase_if(oldParentChildren,
-                          [child](const auto& node) { return node->entity == child; });
+            oldParentChildren.erase(
+              std::remove_if(oldParentChildren.begin(),
+                             oldParentChildren.end(),
+                             [child](const auto& node) { return node->entity == child; }),
+              oldParentChildren.end());
         }
 
         // update the hierarchy relationships
@@ -97,7 +114,11 @@ namespace x {
 
         const XMMATRIX worldTransform = childNode->worldTransform;
         auto& parentChildren          = parentNode->children;
-        std::erase_if(parentChildren, [child](const auto& node) { return node->entity == child; });
+        parentChildren.erase(
+          std::remove_if(parentChildren.begin(),
+                         parentChildren.end(),
+                         [child](const auto& node) { return node->entity == child; }),
+          parentChildren.end());
         childNode->parent.reset();
         childNode->localTransform = worldTransform;
 
@@ -123,19 +144,37 @@ namespace x {
     }
 
     void Scene::Unload() {
-        std::function<void(shared_ptr<SceneNode>)> destroyNode =
-          [&](const shared_ptr<SceneNode>& node) {
-              for (const auto& child : node->children) {
-                  destroyNode(child);
-              }
-              _state.DestroyEntity(node->entity);
-          };
-
-        if (_root) destroyNode(_root);
+        X_PROFILE_FUNCTION();
+        if (_root) {
+            ScratchScope scratch;
+            std::pmr::vector<const SceneNode*> pending({_root.get()}, scratch.Resource());
+            while (!pending.empty()) {
+                const SceneNode* node = pending.back();
+                pending.pop_back();
+                for (const auto& child : node->children) {
+                    pending.push_back(child.get());
+                }
+                DestroyEntity(node->entity);
+            }
+        }
         _nodes.clear();
         _root.reset();
     }
 
+    void Scene::Update() {
+        X_PROFILE_FUNCTION();
+        _state.GetComponents<TransformComponent>().ForEach(
+          [](EntityId, TransformComponent& transform) { transform.Update(); });
+    }
+
+    void Scene::DestroyEntity(EntityId entity) {
+        if (_releaseQueue) {
+            _state.DestroyEntity(entity, *_releaseQueue);
+        } else {
+            _state.DestroyEntity(entity);
+        }
+    }
+
     void Scene::SetWorldTransform(EntityId entity, const XMMATRIX& transform) {
         const auto nodeIt = _nodes.find(entity);
         if (nodeIt == _nodes.end()) { return; }
@@ -159,6 +198,7 @@ namespace x {
 
     void Scene::UpdateWorldTransforms(const shared_ptr<SceneNode>& node,
                                       const XMMATRIX& parentTransform) {
+        X_PROFILE_FUNCTION();
         node->worldTransform = XMMatrixMultiply(parentTransform, node->localTransform);
         if (auto* transform = _state.GetComponentMutable<TransformComponent>(node->entity)) {
             XMVECTOR scale, rotation, position;
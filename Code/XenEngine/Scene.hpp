@@ -6,6 +6,9 @@
 
 #include "Types.hpp"
 #include "GameState.hpp"
+#include "MemoryTracker.hpp"
+#include "PoolAllocator.hpp"
+#include "SmallVector.hpp"
 #include <optional>
 #include <DirectXMath.h>
 
@@ -14,14 +17,28 @@ namespace x {
     public:
         Scene(const str& name, const GameState& state) : _name(name), _state(state) {}
 
+        // Most nodes have a handful of children; more than that spill to the heap
+        static constexpr size_t kInlineChildren = 4;
+
+        // Nodes come from SmallObjectPool, so nodes created together are adjacent in memory
         struct SceneNode {
             EntityId entity;
-            vector<shared_ptr<SceneNode>> children;
+            SmallVector<shared_ptr<SceneNode>,
+                        kInlineChildren,
+                        TaggedAllocator<shared_ptr<SceneNode>, MemoryTag::Scene>>
+              children;
             weak_ptr<SceneNode> parent;
             DirectX::XMMATRIX localTransform;
             DirectX::XMMATRIX worldTransform;
         };
 
+        // With a queue set, entities removed by RemoveEntity() and Unload() hand their
+        // components' resources to it instead of releasing them on the spot, so a scene can be
+        // torn down mid-frame. The queue must outlive the scene or be cleared first.
+        void SetReleaseQueue(DeferredReleaseQueue* queue) {
+            _releaseQueue = queue;
+        }
+
         EntityId CreateEntity(const std::optional<EntityId>& parent = Empty);
         void RemoveEntity(const EntityId& entity);
 
@@ -32,14 +49,22 @@ namespace x {
         bool SaveToFile(const str& filename);
         void Unload();
 
+        // Per-frame component update: rebuilds the matrix of every transform changed since
+        // the last call.
+        void Update();
+
         void SetWorldTransform(EntityId entity, const DirectX::XMMATRIX& transform);
         DirectX::XMMATRIX GetWorldTransform(EntityId entity) const;
 
     private:
         str _name;
         GameState _state;
-        unordered_map<EntityId, shared_ptr<SceneNode>> _nodes;
+        // Nodes, their control blocks and the index are charged to MemoryTag::Scene
+        PooledUnorderedMap<EntityId, shared_ptr<SceneNode>, MemoryTag::Scene> _nodes;
         shared_ptr<SceneNode> _root;
+        DeferredReleaseQueue* _releaseQueue = None;
+
+        void DestroyEntity(EntityId entity);
 
         void UpdateWorldTransforms(const shared_ptr<SceneNode>& node,
                                    const DirectX::XMMATRIX& parentTransform);
@@ -0,0 +1,120 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "ShaderBuildService.hpp"
+
+namespace x {
+    namespace {
+        // Writes `field` as "<length>:<bytes>", so no field's contents can pass for a boundary
+        void AppendField(str& key, std::string_view field) {
+            key += std::to_string(field.size());
+            key += ':';
+            key += field;
+        }
+    }  // namespace
+
+    ShaderBuildService::ShaderBuildService(ThreadPool& pool,
+                                           ShaderCache::CompileFunc compile,
+                                           ShaderCache* cache)
+        : _pool(pool), _compile(std::move(compile)), _cache(cache) {}
+
+    ShaderBuildService::~ShaderBuildService() {
+        // Jobs reference this service
+        WaitAll();
+    }
+
+    ShaderBuildService::Ticket ShaderBuildService::Request(const ShaderSource& source) {
+        Ticket ticket;
+        {
+            std::lock_guard lock(_mutex);
+            const auto [it, inserted] =
+              _tickets.try_emplace(GetRequestKey(source), CAST<Ticket>(_entries.size()));
+            if (!inserted) { return it->second; }
+            ticket = it->second;
+            _entries.push_back({source, {}, false});
+        }
+        _pool.Enqueue([this, ticket]() { Build(ticket); });
+        return ticket;
+    }
+
+    vector<ShaderBuildService::Ticket>
+    ShaderBuildService::Request(const vector<ShaderSource>& sources) {
+        vector<Ticket> tickets;
+        tickets.reserve(sources.size());
+        for (const auto& source : sources) {
+            tickets.push_back(Request(source));
+        }
+        return tickets;
+    }
+
+    bool ShaderBuildService::IsReady(Ticket ticket) const {
+        std::lock_guard lock(_mutex);
+        return _entries.at(ticket).ready;
+    }
+
+    const CompiledShader* ShaderBuildService::TryGet(Ticket ticket) const {
+        std::lock_guard lock(_mutex);
+        const Entry& entry = _entries.at(ticket);
+        return entry.ready ? &entry.result : None;
+    }
+
+    const CompiledShader& ShaderBuildService::Wait(Ticket ticket) {
+        std::unique_lock lock(_mutex);
+        const Entry& entry = _entries.at(ticket);
+        _completed.wait(lock, [&entry]() { return entry.ready; });
+        return entry.result;
+    }
+
+    void ShaderBuildService::WaitAll() {
+        std::unique_lock lock(_mutex);
+        _completed.wait(lock, [this]() { return _completedCount == _entries.size(); });
+    }
+
+    vector<ShaderBuildService::Ticket> ShaderBuildService::PollCompleted() {
+        std::lock_guard lock(_mutex);
+        vector<Ticket> completed;
+        completed.swap(_newlyCompleted);
+        return completed;
+    }
+
+    ShaderBuildService::Progress ShaderBuildService::GetProgress() const {
+        std::lock_guard lock(_mutex);
+        return {CAST<u32>(_entries.size()), _completedCount};
+    }
+
+    void ShaderBuildService::Build(Ticket ticket) {
+        const ShaderSource* source;
+        {
+            std::lock_guard lock(_mutex);
+            source = &_entries[ticket].source;
+        }
+
+        // The source is never mutated after Request, so compiling outside the lock is safe
+        CompiledShader result = _cache ? _cache->Load(*source, _compile) : _compile(*source);
+
+        std::lock_guard lock(_mutex);
+        Entry& entry = _entries[ticket];
+        entry.result = std::move(result);
+        entry.ready  = true;
+        _completedCount++;
+        _newlyCompleted.push_back(ticket);
+        // Notify under the lock; once WaitAll sees the count, the service may be destroyed
+        _completed.notify_all();
+    }
+
+    // Every field is length-prefixed, as in ShaderCache's key, so requests only share a key
+    // when all of their fields match
+    str ShaderBuildService::GetRequestKey(const ShaderSource& source) {
+        str key;
+        AppendField(key, source.path.Str());
+        AppendField(key, source.entryPoint);
+        AppendField(key, source.target);
+        AppendField(key, std::to_string(source.flags));
+        for (const auto& define : source.defines) {
+            AppendField(key, define.name);
+            AppendField(key, define.value);
+        }
+        return key;
+    }
+}  // namespace x
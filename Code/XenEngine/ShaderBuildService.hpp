@@ -0,0 +1,79 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "ShaderCache.hpp"
+#include "ThreadPool.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace x {
+    // Compiles shader requests concurrently on a ThreadPool, through the ShaderCache when one
+    // is given. Identical requests share one ticket and one compile. Results stream back
+    // through PollCompleted() so the renderer can create shader objects for whatever is
+    // ready and keep running while the rest builds.
+    class ShaderBuildService {
+    public:
+        using Ticket = u32;
+
+        struct Progress {
+            u32 requested;
+            u32 completed;
+
+            f32 GetFraction() const {
+                return requested == 0 ? 1.0f : CAST<f32>(completed) / CAST<f32>(requested);
+            }
+        };
+
+        ShaderBuildService(ThreadPool& pool,
+                           ShaderCache::CompileFunc compile,
+                           ShaderCache* cache = None);
+        ~ShaderBuildService();
+
+        ShaderBuildService(const ShaderBuildService&)            = delete;
+        ShaderBuildService& operator=(const ShaderBuildService&) = delete;
+
+        Ticket Request(const ShaderSource& source);
+        vector<Ticket> Request(const vector<ShaderSource>& sources);
+
+        bool IsReady(Ticket ticket) const;
+
+        // Returns None until the ticket has finished compiling.
+        const CompiledShader* TryGet(Ticket ticket) const;
+
+        // Blocks until the ticket has finished compiling.
+        const CompiledShader& Wait(Ticket ticket);
+        void WaitAll();
+
+        // Tickets that finished since the last call, in completion order.
+        vector<Ticket> PollCompleted();
+
+        Progress GetProgress() const;
+
+    private:
+        struct Entry {
+            ShaderSource source;
+            CompiledShader result;
+            bool ready = false;
+        };
+
+        ThreadPool& _pool;
+        ShaderCache::CompileFunc _compile;
+        ShaderCache* _cache;
+
+        mutable std::mutex _mutex;
+        std::condition_variable _completed;
+        std::deque<Entry> _entries;  // Stable addresses; indexed by ticket
+        unordered_map<str, Ticket> _tickets;
+        vector<Ticket> _newlyCompleted;
+        u32 _completedCount = 0;
+
+        void Build(Ticket ticket);
+
+        static str GetRequestKey(const ShaderSource& source);
+    };
+}  // namespace x
@@ -0,0 +1,283 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "ShaderCache.hpp"
+#include "Hash.hpp"
+#include "MetadataCache.hpp"
+#include "Panic.inl"
+
+#include <cstdio>
+#include <string_view>
+
+namespace x {
+    namespace {
+        constexpr u32 kEntryMagic   = 0x43485358;  // "XSHC"
+        constexpr u32 kEntryVersion = 2;
+
+        // Hashes the field's length before its bytes, so neighbouring fields can't trade bytes
+        // ("AB" + "C" vs "A" + "BC") and produce the same key
+        u64 HashField(std::string_view field, u64 hash = kFnv64Offset) {
+            const u64 length = field.size();
+            return Fnv1a64(field, Fnv1a64(&length, sizeof(length), hash));
+        }
+
+        struct EntryHeader {
+            u32 magic;
+            u32 version;
+            u64 key;
+            u32 bytecodeSize;
+            u32 reflectionSize;
+        };
+
+        class ByteWriter {
+        public:
+            explicit ByteWriter(vector<u8>& out) : _out(out) {}
+
+            void U32(u32 value) {
+                Bytes(&value, sizeof(value));
+            }
+
+            void String(const str& value) {
+                U32(CAST<u32>(value.size()));
+                Bytes(value.data(), value.size());
+            }
+
+            void Bytes(const void* data, size_t size) {
+                const auto* bytes = CAST<const u8*>(data);
+                _out.insert(_out.end(), bytes, bytes + size);
+            }
+
+        private:
+            vector<u8>& _out;
+        };
+
+        class ByteReader {
+        public:
+            ByteReader(const u8* data, size_t size) : _data(data), _size(size) {}
+
+            bool U32(u32& value) {
+                return Bytes(&value, sizeof(value));
+            }
+
+            bool String(str& value) {
+                u32 length = 0;
+                if (!U32(length) || _offset + length > _size) { return false; }
+                value.assign(RCAST<const char*>(_data + _offset), length);
+                _offset += length;
+                return true;
+            }
+
+            bool Bytes(void* data, size_t size) {
+                if (_offset + size > _size) { return false; }
+                memcpy(data, _data + _offset, size);
+                _offset += size;
+                return true;
+            }
+
+        private:
+            const u8* _data;
+            size_t _size;
+            size_t _offset = 0;
+        };
+
+        void WriteParameters(ByteWriter& writer,
+                             const vector<ShaderReflection::Parameter>& parameters) {
+            writer.U32(CAST<u32>(parameters.size()));
+            for (const auto& parameter : parameters) {
+                writer.String(parameter.semanticName);
+                writer.U32(parameter.semanticIndex);
+                writer.U32(parameter.registerIndex);
+                writer.U32(parameter.componentType);
+                writer.U32(parameter.mask);
+            }
+        }
+
+        bool ReadParameters(ByteReader& reader, vector<ShaderReflection::Parameter>& parameters) {
+            u32 count = 0;
+            if (!reader.U32(count)) { return false; }
+            parameters.resize(count);
+            for (auto& parameter : parameters) {
+                u32 mask = 0;
+                if (!reader.String(parameter.semanticName) ||
+                    !reader.U32(parameter.semanticIndex) || !reader.U32(parameter.registerIndex) ||
+                    !reader.U32(parameter.componentType) || !reader.U32(mask)) {
+                    return false;
+                }
+                parameter.mask = CAST<u8>(mask);
+            }
+            return true;
+        }
+
+        // Yields the target of each `#include "file"` / `#include <file>` directive.
+        template<typename Func>
+        void ForEachInclude(std::string_view text, Func&& func) {
+            size_t lineStart = 0;
+            while (lineStart < text.size()) {
+                size_t lineEnd = text.find('\n', lineStart);
+                if (lineEnd == std::string_view::npos) { lineEnd = text.size(); }
+                std::string_view line = text.substr(lineStart, lineEnd - lineStart);
+                lineStart             = lineEnd + 1;
+
+                const size_t hash = line.find_first_not_of(" \t");
+                if (hash == std::string_view::npos || line[hash] != '#') { continue; }
+                line                   = line.substr(hash + 1);
+                const size_t directive = line.find_first_not_of(" \t");
+                if (directive == std::string_view::npos ||
+                    line.substr(directive, 7) != "include") {
+                    continue;
+                }
+                line              = line.substr(directive + 7);
+                const size_t open = line.find_first_of("\"<");
+                if (open == std::string_view::npos) { continue; }
+                const char closing = line[open] == '"' ? '"' : '>';
+                const size_t close = line.find(closing, open + 1);
+                if (close == std::string_view::npos) { continue; }
+                func(line.substr(open + 1, close - open - 1));
+            }
+        }
+    }  // namespace
+
+    void ShaderReflection::Serialize(vector<u8>& out) const {
+        ByteWriter writer(out);
+        writer.U32(instructionCount);
+        writer.U32(CAST<u32>(constantBuffers.size()));
+        for (const auto& buffer : constantBuffers) {
+            writer.String(buffer.name);
+            writer.U32(buffer.size);
+            writer.U32(buffer.variableCount);
+        }
+        writer.U32(CAST<u32>(boundResources.size()));
+        for (const auto& resource : boundResources) {
+            writer.String(resource.name);
+            writer.U32(resource.type);
+            writer.U32(resource.bindPoint);
+            writer.U32(resource.bindCount);
+        }
+        WriteParameters(writer, inputs);
+        WriteParameters(writer, outputs);
+    }
+
+    bool ShaderReflection::Deserialize(const u8* data, size_t size) {
+        ByteReader reader(data, size);
+        u32 count = 0;
+        if (!reader.U32(instructionCount) || !reader.U32(count)) { return false; }
+        constantBuffers.resize(count);
+        for (auto& buffer : constantBuffers) {
+            if (!reader.String(buffer.name) || !reader.U32(buffer.size) ||
+                !reader.U32(buffer.variableCount)) {
+                return false;
+            }
+        }
+        if (!reader.U32(count)) { return false; }
+        boundResources.resize(count);
+        for (auto& resource : boundResources) {
+            if (!reader.String(resource.name) || !reader.U32(resource.type) ||
+                !reader.U32(resource.bindPoint) || !reader.U32(resource.bindCount)) {
+                return false;
+            }
+        }
+        return ReadParameters(reader, inputs) && ReadParameters(reader, outputs);
+    }
+
+    ShaderCache::ShaderCache(const Filesystem::Path& directory)
+        : _directory(directory), _hits(0), _misses(0) {
+        if (!_directory.CreateAll()) { Panic("Failed to create shader cache directory"); }
+    }
+
+    CompiledShader ShaderCache::Load(const ShaderSource& source, const CompileFunc& compile) {
+        const u64 key = ComputeKey(source);
+        CompiledShader shader;
+        if (TryRead(key, shader)) {
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            return shader;
+        }
+
+        _misses.fetch_add(1, std::memory_order_relaxed);
+        shader = compile(source);
+        Write(key, shader);
+        return shader;
+    }
+
+    u64 ShaderCache::ComputeKey(const ShaderSource& source) const {
+        std::unordered_set<str> visited;
+        u64 hash = HashSourceTree(source.path, Fnv1a64(&kEntryVersion, sizeof(u32)), visited);
+        hash     = HashCombine(hash, HashField(source.entryPoint));
+        hash     = HashCombine(hash, HashField(source.target));
+        for (const auto& define : source.defines) {
+            hash = HashCombine(hash, HashField(define.name));
+            hash = HashCombine(hash, HashField(define.value));
+        }
+        return HashCombine(hash, source.flags);
+    }
+
+    Filesystem::Path ShaderCache::GetEntryPath(u64 key) const {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.xsc", CAST<unsigned long long>(key));
+        return _directory / name;
+    }
+
+    bool ShaderCache::TryRead(u64 key, CompiledShader& shader) const {
+        const auto bytes = Filesystem::FileReader::ReadAllBytes(GetEntryPath(key));
+        if (bytes.size() < sizeof(EntryHeader)) { return false; }
+
+        EntryHeader header {};
+        memcpy(&header, bytes.data(), sizeof(header));
+        if (header.magic != kEntryMagic || header.version != kEntryVersion || header.key != key ||
+            sizeof(header) + header.bytecodeSize + header.reflectionSize != bytes.size()) {
+            return false;
+        }
+
+        const u8* bytecode = bytes.data() + sizeof(header);
+        shader.bytecode.assign(bytecode, bytecode + header.bytecodeSize);
+        return shader.reflection.Deserialize(bytecode + header.bytecodeSize,
+                                             header.reflectionSize);
+    }
+
+    void ShaderCache::Write(u64 key, const CompiledShader& shader) const {
+        vector<u8> reflection;
+        shader.reflection.Serialize(reflection);
+
+        const EntryHeader header {kEntryMagic,
+                                  kEntryVersion,
+                                  key,
+                                  CAST<u32>(shader.bytecode.size()),
+                                  CAST<u32>(reflection.size())};
+        vector<u8> bytes(sizeof(header));
+        memcpy(bytes.data(), &header, sizeof(header));
+        bytes.insert(bytes.end(), shader.bytecode.begin(), shader.bytecode.end());
+        bytes.insert(bytes.end(), reflection.begin(), reflection.end());
+
+        // Write-then-rename so a concurrent or interrupted writer never leaves a torn entry.
+        // A failed write only costs a recompile next time.
+        static std::atomic<u32> tempCounter {0};
+        const auto path = GetEntryPath(key);
+        const auto temp =
+          Filesystem::Path(path.Str() + "." + std::to_string(tempCounter.fetch_add(1)) + ".tmp");
+        if (!Filesystem::FileWriter::WriteAllBytes(temp, bytes) ||
+            std::rename(temp.CStr(), path.CStr()) != 0) {
+            std::remove(temp.CStr());
+        }
+        Filesystem::MetadataCache::Global().Invalidate(path.Str());
+    }
+
+    u64 ShaderCache::HashSourceTree(const Filesystem::Path& path,
+                                    u64 hash,
+                                    std::unordered_set<str>& visited) {
+        if (!visited.insert(path.Str()).second) { return hash; }
+
+        const str text = Filesystem::FileReader::ReadAllText(path);
+        hash           = HashField(text, hash);
+        ForEachInclude(text, [&](std::string_view include) {
+            const auto resolved = path.Parent() / str(include);
+            if (resolved.Exists()) {
+                hash = HashSourceTree(resolved, hash, visited);
+            } else {
+                // System or search-path include; the name is all we can key on. The marker
+                // keeps it from matching a resolved file whose text equals the name.
+                hash = HashField(include, HashField("<unresolved>", hash));
+            }
+        });
+        return hash;
+    }
+}  // namespace x
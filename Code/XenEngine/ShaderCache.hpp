@@ -0,0 +1,103 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "Filesystem.hpp"
+#include <atomic>
+#include <functional>
+#include <unordered_set>
+
+namespace x {
+    struct ShaderDefine {
+        str name;
+        str value;
+    };
+
+    struct ShaderSource {
+        Filesystem::Path path;
+        str entryPoint;
+        str target;
+        vector<ShaderDefine> defines;
+        u32 flags = 0;
+    };
+
+    // The parts of backend reflection the engine consumes, in a form that can be cached.
+    struct ShaderReflection {
+        struct ConstantBuffer {
+            str name;
+            u32 size;
+            u32 variableCount;
+        };
+
+        struct BoundResource {
+            str name;
+            u32 type;
+            u32 bindPoint;
+            u32 bindCount;
+        };
+
+        struct Parameter {
+            str semanticName;
+            u32 semanticIndex;
+            u32 registerIndex;
+            u32 componentType;
+            u8 mask;
+        };
+
+        u32 instructionCount = 0;
+        vector<ConstantBuffer> constantBuffers;
+        vector<BoundResource> boundResources;
+        vector<Parameter> inputs;
+        vector<Parameter> outputs;
+
+        void Serialize(vector<u8>& out) const;
+        bool Deserialize(const u8* data, size_t size);
+    };
+
+    struct CompiledShader {
+        vector<u8> bytecode;
+        ShaderReflection reflection;
+    };
+
+    // Persistent bytecode cache. Entries are keyed by a hash of the source text, the text of
+    // every transitively #included file (resolved relative to the including file, as the
+    // standard D3D include handler does), the defines, entry point, target and compile flags.
+    // Editing any input yields a new key, so stale entries are simply never looked up again.
+    // Safe to call from multiple threads.
+    class ShaderCache {
+    public:
+        using CompileFunc = std::function<CompiledShader(const ShaderSource&)>;
+
+        struct Stats {
+            u32 hits;
+            u32 misses;
+        };
+
+        explicit ShaderCache(const Filesystem::Path& directory);
+
+        // Returns the cached result for `source`, compiling and storing it on a miss.
+        CompiledShader Load(const ShaderSource& source, const CompileFunc& compile);
+
+        u64 ComputeKey(const ShaderSource& source) const;
+
+        Stats GetStats() const {
+            return {_hits.load(std::memory_order_relaxed), _misses.load(std::memory_order_relaxed)};
+        }
+
+    private:
+        Filesystem::Path _directory;
+        std::atomic<u32> _hits;
+        std::atomic<u32> _misses;
+
+        Filesystem::Path GetEntryPath(u64 key) const;
+        bool TryRead(u64 key, CompiledShader& shader) const;
+        void Write(u64 key, const CompiledShader& shader) const;
+
+        static u64 HashSourceTree(const Filesystem::Path& path,
+                                  u64 hash,
+                                  std::unordered_set<str>& visited);
+    };
+}  // namespace x
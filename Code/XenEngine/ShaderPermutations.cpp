@@ -0,0 +1,171 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#include "ShaderPermutations.hpp"
+#include "LineScanner.hpp"
+#include "Panic.inl"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <sstream>
+
+namespace x {
+    namespace {
+        constexpr std::string_view kKeywordsTag = "//@keywords";
+
+        vector<str> ParseKeywords(const Filesystem::Path& path) {
+            vector<str> keywords;
+            for (const auto& line : Filesystem::FileReader::ReadAllLines(path)) {
+                const size_t start = line.find_first_not_of(" \t");
+                if (start == str::npos || line.compare(start, kKeywordsTag.size(), kKeywordsTag)) {
+                    continue;
+                }
+                std::istringstream stream(line.substr(start + kKeywordsTag.size()));
+                str keyword;
+                while (stream >> keyword) {
+                    if (std::find(keywords.begin(), keywords.end(), keyword) == keywords.end()) {
+                        keywords.push_back(keyword);
+                    }
+                }
+            }
+            return keywords;
+        }
+    }  // namespace
+
+    void ShaderVariantManifest::Record(const str& shaderId, ShaderKeywordMask mask) {
+        _variants[shaderId].insert(mask);
+    }
+
+    bool ShaderVariantManifest::Contains(const str& shaderId, ShaderKeywordMask mask) const {
+        const auto it = _variants.find(shaderId);
+        return it != _variants.end() && it->second.contains(mask);
+    }
+
+    vector<ShaderKeywordMask> ShaderVariantManifest::GetVariants(const str& shaderId) const {
+        const auto it = _variants.find(shaderId);
+        if (it == _variants.end()) { return {}; }
+        vector<ShaderKeywordMask> variants(it->second.begin(), it->second.end());
+        std::sort(variants.begin(), variants.end());
+        return variants;
+    }
+
+    bool ShaderVariantManifest::Save(const Filesystem::Path& path) const {
+        vector<str> lines;
+        for (const auto& [shaderId, masks] : _variants) {
+            for (const auto mask : masks) {
+                lines.push_back(shaderId + " " + std::to_string(mask));
+            }
+        }
+        std::sort(lines.begin(), lines.end());
+        return Filesystem::FileWriter::WriteAllLines(path, lines);
+    }
+
+    // Either every line parses and is recorded, or nothing is and this returns false
+    bool ShaderVariantManifest::Load(const Filesystem::Path& path) {
+        const Filesystem::LineFile file(path);
+        if (!file.IsOpen()) { return false; }
+
+        vector<std::pair<std::string_view, ShaderKeywordMask>> entries;
+        entries.reserve(file.GetLineCount());
+        for (size_t i = 0; i < file.GetLineCount(); ++i) {
+            const std::string_view line = file.GetLine(i);
+            if (line.empty()) { continue; }
+            const size_t split = line.find_last_of(' ');
+            if (split == std::string_view::npos || split == 0) { return false; }
+
+            // Rejects signs, trailing junk and anything that doesn't fit a mask
+            const std::string_view digits = line.substr(split + 1);
+            ShaderKeywordMask mask        = 0;
+            const auto [end, error] =
+              std::from_chars(digits.data(), digits.data() + digits.size(), mask);
+            if (error != std::errc() || end != digits.data() + digits.size()) { return false; }
+            entries.emplace_back(line.substr(0, split), mask);
+        }
+
+        for (const auto& [shaderId, mask] : entries) {
+            Record(str(shaderId), mask);
+        }
+        return true;
+    }
+
+    ShaderPermutationSet::ShaderPermutationSet(const ShaderSource& source,
+                                               ShaderBuildService& buildService)
+        : _source(source), _buildService(buildService),
+          _id(source.path.Str() + ":" + source.entryPoint + ":" + source.target),
+          _keywords(ParseKeywords(source.path)) {
+        if (_keywords.size() > kMaxKeywords) { Panic("Shader declares more than 32 keywords"); }
+    }
+
+    ShaderKeywordMask ShaderPermutationSet::GetKeywordMask(std::string_view keyword) const {
+        for (u32 i = 0; i < _keywords.size(); ++i) {
+            if (_keywords[i] == keyword) { return 1u << i; }
+        }
+        return 0;
+    }
+
+    ShaderBuildService::Ticket ShaderPermutationSet::Request(ShaderKeywordMask mask) {
+        if (const auto it = _variants.find(mask); it != _variants.end()) { return it->second; }
+
+        const ShaderKeywordMask resolved = ResolveMask(mask);
+        if (_manifest && !_strip) { _manifest->Record(_id, resolved); }
+
+        ShaderBuildService::Ticket ticket;
+        if (const auto it = _variants.find(resolved); it != _variants.end()) {
+            ticket = it->second;
+        } else {
+            ticket = _buildService.Request(MakeVariantSource(resolved));
+            _variants.emplace(resolved, ticket);
+        }
+        // Cache the original mask too so stripped lookups stay one probe
+        _variants.emplace(mask, ticket);
+        return ticket;
+    }
+
+    const CompiledShader* ShaderPermutationSet::TryGet(ShaderKeywordMask mask) {
+        return _buildService.TryGet(Request(mask));
+    }
+
+    const CompiledShader& ShaderPermutationSet::Get(ShaderKeywordMask mask) {
+        return _buildService.Wait(Request(mask));
+    }
+
+    void ShaderPermutationSet::SetManifest(ShaderVariantManifest* manifest, bool strip) {
+        _manifest = manifest;
+        _strip    = manifest && strip;
+        // Earlier lookups may have resolved differently
+        _variants.clear();
+    }
+
+    void ShaderPermutationSet::Prewarm() {
+        if (!_manifest) { return; }
+        for (const auto mask : _manifest->GetVariants(_id)) {
+            Request(mask);
+        }
+    }
+
+    ShaderKeywordMask ShaderPermutationSet::ResolveMask(ShaderKeywordMask mask) const {
+        if (!_strip || _manifest->Contains(_id, mask)) { return mask; }
+
+        bool found             = false;
+        ShaderKeywordMask best = 0;
+        for (const auto candidate : _manifest->GetVariants(_id)) {
+            if ((candidate & ~mask) != 0) { continue; }
+            if (!found || std::popcount(candidate) > std::popcount(best)) {
+                best  = candidate;
+                found = true;
+            }
+        }
+        if (!found) { Panic("No shipped variant of %s matches mask %u", _id.c_str(), mask); }
+        return best;
+    }
+
+    ShaderSource ShaderPermutationSet::MakeVariantSource(ShaderKeywordMask mask) const {
+        ShaderSource source = _source;
+        for (u32 i = 0; i < _keywords.size(); ++i) {
+            if ((mask & (1u << i)) != 0) { source.defines.push_back({_keywords[i], "1"}); }
+        }
+        return source;
+    }
+}  // namespace x
@@ -0,0 +1,89 @@
+// Author: Jake Rieger
+// Created: 10/18/2026.
+//
+
+#pragma once
+
+#include "Types.hpp"
+#include "ShaderBuildService.hpp"
+#include <string_view>
+#include <unordered_set>
+
+namespace x {
+    // One bit per keyword, in declaration order.
+    using ShaderKeywordMask = u32;
+
+    // Records which variants were actually used, so shipping builds can compile (and
+    // package) only those. Stored as text, one "<shader id> <mask>" pair per line.
+    class ShaderVariantManifest {
+    public:
+        void Record(const str& shaderId, ShaderKeywordMask mask);
+        bool Contains(const str& shaderId, ShaderKeywordMask mask) const;
+        vector<ShaderKeywordMask> GetVariants(const str& shaderId) const;
+
+        bool Save(const Filesystem::Path& path) const;
+        bool Load(const Filesystem::Path& path);
+
+    private:
+        unordered_map<str, std::unordered_set<ShaderKeywordMask>> _variants;
+    };
+
+    // All keyword variants of one shader entry point. Keywords are declared in the HLSL file
+    // with a comment line such as
+    //
+    //     //@keywords SKINNED FOG SHADOWS
+    //
+    // and each set keyword is compiled in as `#define KEYWORD 1`. Variants are requested from
+    // the build service on first use, so only the combinations actually drawn get compiled.
+    // Lookups are a single hash map probe. Not thread-safe; resolve variants before handing
+    // work to recording threads.
+    class ShaderPermutationSet {
+    public:
+        static constexpr u32 kMaxKeywords = 32;
+
+        ShaderPermutationSet(const ShaderSource& source, ShaderBuildService& buildService);
+
+        ShaderPermutationSet(const ShaderPermutationSet&)            = delete;
+        ShaderPermutationSet& operator=(const ShaderPermutationSet&) = delete;
+
+        // Returns 0 for keywords the shader doesn't declare.
+        ShaderKeywordMask GetKeywordMask(std::string_view keyword) const;
+
+        // Starts compiling the variant if it hasn't been requested yet.
+        ShaderBuildService::Ticket Request(ShaderKeywordMask mask);
+
+        // Returns None while the variant is still compiling.
+        const CompiledShader* TryGet(ShaderKeywordMask mask);
+
+        // Blocks until the variant is compiled.
+        const CompiledShader& Get(ShaderKeywordMask mask);
+
+        // Every variant used is recorded into `manifest`. When `strip` is set, only variants
+        // already listed in it are ever compiled; any other mask resolves to the listed
+        // variant with the most keywords that is a subset of it.
+        void SetManifest(ShaderVariantManifest* manifest, bool strip);
+
+        // Requests every variant listed in the manifest for this shader.
+        void Prewarm();
+
+        const vector<str>& GetKeywords() const {
+            return _keywords;
+        }
+
+        const str& GetId() const {
+            return _id;
+        }
+
+    private:
+        ShaderSource _source;
+        ShaderBuildService& _buildService;
+        str _id;
+        vector<str> _keywords;
+        unordered_map<ShaderKeywordMask, ShaderBuildService::Ticket> _variants;
+        ShaderVariantManifest* _manifest = None;
+        bool _strip                      = false;
+
+        ShaderKeywordMask ResolveMask(ShaderKeywordMask mask) const;
+        ShaderSource MakeVariantSource(ShaderKeywordMask mask) const;
+    };
+}  // namespace x
@@ -0,0 +1,16 @@
+#ifndef COMMON_HLSLI
+#define COMMON_HLSLI
+
+cbuffer PerFrame : register(b0) {
+    float4x4 ViewProjection;
+    float3 CameraPosition;
+    float Time;
+    float3 FogColor;
+    float FogDensity;
+};
+
+cbuffer PerObject : register(b1) {
+    float4x4 World;
+};
+
+#endif
@@ -0,0 +1,46 @@
+//@keywords VERTEX_COLOR FOG
+
+#include "Include/Common.hlsli"
+
+cbuffer Material : register(b2) {
+    float4 BaseColor;
+};
+
+struct VSInput {
+    float3 position : POSITION;
+#if VERTEX_COLOR
+    float4 color : COLOR;
+#endif
+};
+
+struct PSInput {
+    float4 position : SV_Position;
+    float3 worldPosition : POSITION;
+#if VERTEX_COLOR
+    float4 color : COLOR;
+#endif
+};
+
+PSInput VSMain(VSInput input) {
+    PSInput output;
+    const float4 worldPosition = mul(float4(input.position, 1.0), World);
+    output.position            = mul(worldPosition, ViewProjection);
+    output.worldPosition       = worldPosition.xyz;
+#if VERTEX_COLOR
+    output.color = input.color;
+#endif
+    return output;
+}
+
+float4 PSMain(PSInput input) : SV_Target {
+    float4 color = BaseColor;
+#if VERTEX_COLOR
+    color *= input.color;
+#endif
+#if FOG
+    const float distance = length(input.worldPosition - CameraPosition);
+    const float fog      = saturate(exp(-FogDensity * distance));
+    color.rgb            = lerp(FogColor, color.rgb, fog);
+#endif
+    return color;
+}